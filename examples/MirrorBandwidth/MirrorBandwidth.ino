@@ -0,0 +1,66 @@
+/**
+ * Measures the mirror stream of a typical 20x4 status screen: one value
+ * changes every 200 ms; clock, second value and 4-cell sparkline change
+ * every second. The mirror is written into a counting sink, so the
+ * report on Serial is not mixed with the stream. Every 60 s the sketch
+ * prints bytes per second (myLCD::mirrorBytes()) and the largest frame.
+ */
+
+#define MYLCD_MIRROR
+#include <mylcd.h>
+#include <mycanvas.h>
+
+myLCD lcd(7, 8, 6, 5, 4, 3);
+myCanvas graph(lcd, 4, 1, 0, 100);
+
+class sink: public Print {
+	public:
+		size_t write(uint8_t) {
+			return 1;
+		}
+} counter;
+
+unsigned long fast, slow, report;
+size_t largest;
+int pressure, temp, seconds;
+
+void setup() {
+	Serial.begin(9600);
+	lcd.begin(20, 4);
+	lcd.display(0, 0, F("Boiler"));
+	lcd.display(0, 1, F("P:"));
+	lcd.display(0, 2, F("T:"));
+	graph.begin(16, 3);
+	lcd.mirror(counter, 200);
+	fast = slow = report = millis();
+}
+
+void loop() {
+	unsigned long now = millis();
+	if (now - fast >= 200) {
+		fast += 200;
+		pressure = (pressure + 7) % 1000;
+		lcd.line(2, 1, 8, pad(5, decimal<1>(pressure)), F("bar"));
+	}
+	if (now - slow >= 1000) {
+		slow += 1000;
+		++seconds;
+		temp = 200 + seconds % 50;
+		lcd.line(2, 2, 8, pad(5, decimal<1>(temp)), 'C');
+		lcd.line(12, 0, 8, pad(2, seconds / 3600 % 24, '0'), ':', pad(2, seconds / 60 % 60, '0'), ':',
+				pad(2, seconds % 60, '0'));
+		graph.add(temp % 100);
+		graph.draw();
+	}
+	size_t n = lcd.mirrorUpdate();
+	if (n > largest) largest = n;
+	if (now - report >= 60000) {
+		report += 60000;
+		Serial.print(F("mirror bytes/s: "));
+		Serial.print(lcd.mirrorBytes() / 60);
+		Serial.print(F(", largest frame: "));
+		Serial.println(largest);
+		lcd.mirror(counter, 200); // restart counting, sends a full frame
+		largest = 0;
+	}
+}
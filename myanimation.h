@@ -0,0 +1,188 @@
+/**
+ * @file myanimation.h
+ *
+ * @date 19.10.2026
+ * @see myLCD
+ */
+
+#ifndef MYANIMATION_H_
+#define MYANIMATION_H_
+#include "mylcd.h"
+
+/*************************************//**
+ * CGRAM animation scheduler.
+ * Animates custom characters by redefining CGRAM slots. Every cell
+ * showing the slot changes at once, so any number of on-screen copies
+ * cost one CGRAM write. Only the bitmap rows that differ between
+ * consecutive frames are uploaded and the cursor is restored afterwards.
+ *
+ * Animator is driven either by update() from loop() or by the display's
+ * timer list (myLCD::service(), myLCD::nextDeadline()).
+ *
+ * @example animation
+ * @code{.cpp}
+ *
+ * 	#include "myanimation.h"
+ * 	myLCD lcd(7,8,6,5,4,3);
+ * 	myAnimator animator(lcd);
+ *
+ * 	// 4 frames, 8 bytes each
+ * 	static const byte SPINNER[] PROGMEM = {
+ * 		0x00, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00,
+ * 		0x00, 0x01, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00,
+ * 		0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00,
+ * 		0x00, 0x00, 0x00, 0x04, 0x02, 0x01, 0x00, 0x00,
+ * 	};
+ *
+ * 	void setup(){
+ * 		lcd.begin(16, 2);
+ * 		animator.add(0, SPINNER, 4, 150); // slot 0, 4 frames, 150ms per frame
+ * 		lcd.display(15, 0, (char) 0);
+ * 	}
+ *
+ * 	void loop(){
+ * 		animator.update();
+ * 	}
+ * @endcode
+ *
+ ***************************************/
+
+#ifndef MAXANIMATIONS
+#define MAXANIMATIONS 4 //!< number of simultaneous animations
+#endif
+
+class myAnimator: public myTimer {
+	public:
+		/**
+		 * Constructor
+		 * @param lcd Display
+		 */
+		myAnimator(myLCD &lcd)
+				: _lcd(lcd), _used(0) {
+		}
+		;
+		~myAnimator() {
+			_lcd.cancel(*this);
+		}
+		boolean add(uint8_t location, const byte *frames, uint8_t count, uint16_t interval);
+		void remove(uint8_t location);
+		size_t update();
+		void fire(unsigned long now);
+
+	private:
+		struct animation {
+				const byte *frames; //!< PROGMEM frames, 8 bytes each
+				unsigned long due; //!< time of the next frame
+				uint16_t interval; //!< milliseconds per frame
+				uint8_t count; //!< number of frames
+				uint8_t frame; //!< current frame
+				uint8_t location; //!< CGRAM slot
+		};
+
+		size_t _step(animation &a);
+		size_t _service(unsigned long now);
+
+		myLCD &_lcd;
+		animation _anim[MAXANIMATIONS];
+		uint8_t _used;
+		unsigned long _due; //!< earliest due time of all animations
+};
+
+/**
+ * Starts animation. First frame is uploaded immediately.
+ * @param location CGRAM slot 0-7
+ * @param frames PROGMEM bitmaps, 8 bytes per frame
+ * @param count Number of frames
+ * @param interval Milliseconds per frame
+ * @return false if there is no free animation slot
+ */
+inline boolean myAnimator::add(uint8_t location, const byte *frames, uint8_t count, uint16_t interval) {
+	remove(location);
+	if (_used >= MAXANIMATIONS || count == 0) return false;
+
+	animation &a = _anim[_used++];
+	a.frames = frames;
+	a.interval = interval ? interval : 1; // 0 would fire on every service() call
+	a.count = count;
+	a.frame = 0;
+	a.location = location & 0x7;
+	a.due = millis() + a.interval;
+	if (_used == 1 || (long) (a.due - _due) < 0) _due = a.due;
+	_lcd.schedule(*this, _due);
+
+	_lcd.createChar(location, frames);
+	return true;
+}
+
+/**
+ * Stops animation, the slot keeps its current frame
+ * @param location CGRAM slot 0-7
+ */
+inline void myAnimator::remove(uint8_t location) {
+	location &= 0x7;
+	for (uint8_t i = 0; i < _used; ++i) {
+		if (_anim[i].location == location) {
+			_anim[i] = _anim[--_used];
+			if (_used == 0) _lcd.cancel(*this);
+			return;
+		}
+	}
+}
+
+/**
+ * Advances due animations. Call it from loop(); when nothing is due,
+ * it costs one millis() call and one comparison.
+ * @return number of bytes sent to display
+ */
+inline size_t myAnimator::update() {
+	if (_used == 0) return 0;
+	unsigned long now = millis();
+	if ((long) (now - _due) < 0) return 0;
+	return _service(now);
+}
+
+/**
+ * Called by myLCD::service()
+ */
+inline void myAnimator::fire(unsigned long now) {
+	if (_used > 0) _service(now);
+}
+
+/**
+ * Advances due animations and schedules the next frame
+ * @param now
+ * @return number of bytes sent to display
+ */
+inline size_t myAnimator::_service(unsigned long now) {
+	size_t n = 0;
+	_due = now + 0xFFFF;
+	for (uint8_t i = 0; i < _used; ++i) {
+		animation &a = _anim[i];
+		if ((long) (now - a.due) >= 0) {
+			n += _step(a);
+			a.due += a.interval;
+			if ((long) (now - a.due) >= 0) a.due = now + a.interval; // we are late, do not catch up
+		}
+		if ((long) (a.due - _due) < 0) _due = a.due;
+	}
+	_lcd.schedule(*this, _due);
+	return _lcd.updateDone(n);
+}
+
+/**
+ * Moves to the next frame and uploads rows that differ from the current one
+ * @return number of bytes sent to display
+ */
+inline size_t myAnimator::_step(animation &a) {
+	const byte *prev = a.frames + (a.frame << 3);
+	if (++a.frame >= a.count) a.frame = 0;
+	const byte *next = a.frames + (a.frame << 3);
+
+	size_t n = 0;
+	for (uint8_t row = 0; row < 8; ++row) {
+		n += _lcd.updateChar(a.location, row, pgm_read_byte(next + row), pgm_read_byte(prev + row));
+	}
+	return n;
+}
+
+#endif /* MYANIMATION_H_ */
@@ -0,0 +1,188 @@
+/**
+ * @file mycanvas.h
+ *
+ * @date 19.10.2026
+ * @see myLCD
+ */
+
+#ifndef MYCANVAS_H_
+#define MYCANVAS_H_
+#include "mylcd.h"
+
+/*************************************//**
+ * Sparkline (trend graph) canvas.
+ * The 8 custom characters are used as pixel framebuffer: 8x1 cells give
+ * 40x8 pixels, 4x2 cells give 20x16 pixels. Canvas keeps the last samples
+ * in ring buffer and the uploaded bitmap in RAM, so only the CGRAM rows
+ * that changed since the previous frame are sent to display.
+ *
+ * RAM usage is 40 bytes of samples and 64 bytes of bitmap.
+ *
+ * @example canvas
+ * @code{.cpp}
+ *
+ * 	#include "mycanvas.h"
+ * 	myLCD lcd(7,8,6,5,4,3);
+ * 	myCanvas graph(lcd, 8, 1, 0, 100); // 40x8 pixels, values 0-100
+ *
+ * 	void setup(){
+ * 		lcd.begin(20, 4);
+ * 		graph.begin(12, 0);
+ * 	}
+ *
+ * 	void loop(){
+ * 		graph.add(analogRead(A0) / 10);
+ * 		graph.draw();
+ * 		delay(1000);
+ * 	}
+ * @endcode
+ *
+ ***************************************/
+
+#define CANVAS_SAMPLES 40 //!< ring buffer size, maximum canvas width
+
+class myCanvas {
+	public:
+		/**
+		 * Constructor
+		 * @param lcd Display
+		 * @param cols Canvas width in cells
+		 * @param rows Canvas height in cells, cols * rows must not exceed 8
+		 * @param lo Value shown in the bottom of the canvas
+		 * @param hi Value shown in the top of the canvas, must be greater than lo
+		 * @param fill Draw bars instead of the line
+		 */
+		myCanvas(myLCD &lcd, uint8_t cols, uint8_t rows, int lo, int hi, boolean fill = false)
+				: _lcd(lcd), _cols(cols), _rows(rows), _lo(lo), _hi(hi), _fill(fill), _head(0), _count(0) {
+			if (_hi <= _lo) _hi = _lo + 1; // empty range
+			memset(_bitmap, 0, sizeof(_bitmap));
+		}
+		;
+		size_t begin(byte col, byte row);
+		void add(int value);
+		void reset();
+		size_t draw();
+
+	private:
+		uint8_t _sample(uint8_t i) const;
+		void _range(uint8_t x, uint8_t &top, uint8_t &bottom) const;
+
+		myLCD &_lcd;
+		uint8_t _cols;
+		uint8_t _rows;
+		int _lo;
+		int _hi;
+		boolean _fill;
+		uint8_t _head; //!< next write position in ring buffer
+		uint8_t _count; //!< number of samples in ring buffer
+		uint8_t _samples[CANVAS_SAMPLES]; //!< sample heights in pixels
+		byte _bitmap[64]; //!< uploaded CGRAM contents
+};
+
+/**
+ * Places canvas on screen and uploads the whole bitmap
+ * @param col Cursor Position
+ * @param row Cursor Line
+ * @return number of bytes sent to display
+ */
+inline size_t myCanvas::begin(byte col, byte row) {
+	size_t n = 0;
+	for (uint8_t y = 0; y < _rows; ++y) {
+		_lcd.setCursor(col, row + y);
+		for (uint8_t x = 0; x < _cols; ++x) {
+			_lcd.write(y * _cols + x);
+		}
+		n += _cols + 1;
+	}
+	for (uint8_t slot = 0; slot < _cols * _rows; ++slot) {
+		_lcd.createChar(slot, (ram) (_bitmap + (slot << 3)));
+		n += 10;
+	}
+	return n;
+}
+
+/**
+ * Appends sample to ring buffer. Use draw() to show it.
+ * @param value
+ */
+inline void myCanvas::add(int value) {
+	uint8_t height = _rows * 8;
+	value = constrain(value, _lo, _hi);
+	_samples[_head] = (long) (value - _lo) * (height - 1) / (_hi - _lo);
+	if (++_head >= CANVAS_SAMPLES) _head = 0;
+	if (_count < _cols * 5) ++_count;
+}
+
+/**
+ * Removes all samples. Use draw() to clear the canvas.
+ */
+inline void myCanvas::reset() {
+	_count = 0;
+}
+
+/**
+ * Sample height
+ * @param i 0 is the oldest sample
+ * @return height in pixels, 0 is the bottom
+ */
+inline uint8_t myCanvas::_sample(uint8_t i) const {
+	int8_t pos = _head - _count + i;
+	if (pos < 0) pos += CANVAS_SAMPLES;
+	return _samples[pos];
+}
+
+/**
+ * Lit pixels of canvas column
+ * @param x Column, newest sample is in the right edge
+ * @param top First lit pixel, 0 is the top row
+ * @param bottom Last lit pixel, column is empty if top > bottom
+ */
+inline void myCanvas::_range(uint8_t x, uint8_t &top, uint8_t &bottom) const {
+	uint8_t height = _rows * 8;
+	int8_t i = x - (_cols * 5 - _count);
+	if (i < 0) {
+		top = 1;
+		bottom = 0;
+		return;
+	}
+	top = bottom = height - 1 - _sample(i);
+	if (_fill) {
+		bottom = height - 1;
+	} else if (i > 0) { // connect to the previous sample
+		uint8_t prev = height - 1 - _sample(i - 1);
+		if (prev < top) top = prev + 1;
+		else if (prev > bottom) bottom = prev - 1;
+	}
+}
+
+/**
+ * Rasterizes samples and uploads the rows that differ from the
+ * previous frame
+ * @return number of bytes sent to display
+ */
+inline size_t myCanvas::draw() {
+	size_t n = 0;
+	for (uint8_t slot = 0; slot < _cols * _rows; ++slot) {
+		uint8_t cx = (slot % _cols) * 5;
+		uint8_t cy = (slot / _cols) * 8;
+		uint8_t top[5], bottom[5];
+		for (uint8_t c = 0; c < 5; ++c) {
+			_range(cx + c, top[c], bottom[c]);
+		}
+
+		for (uint8_t row = 0; row < 8; ++row) {
+			uint8_t y = cy + row;
+			byte bits = 0;
+			for (uint8_t c = 0; c < 5; ++c) {
+				bits <<= 1;
+				if (y >= top[c] && y <= bottom[c]) bits |= 1;
+			}
+			byte &old = _bitmap[(slot << 3) + row];
+			n += _lcd.updateChar(slot, row, bits, old);
+			old = bits;
+		}
+	}
+	return _lcd.updateDone(n);
+}
+
+#endif /* MYCANVAS_H_ */
@@ -95,16 +95,178 @@ namespace types {
 	};
 	struct lowerID {
 	};
+	struct ramID {
+	};
+	struct glyphID {
+	};
+	struct ramtextID {
+	};
 }
 
 typedef strong_typedef <const PROGMEM char*, types::progmemID> progmem;
 typedef strong_typedef <const PROGMEM char*, types::upperID> upper;
 typedef strong_typedef <const PROGMEM char*, types::lowerID> lower;
+typedef strong_typedef <const byte*, types::ramID> ram; //!< RAM bitmap, usage createChar(0, (ram)bitmap);
+typedef strong_typedef <uint8_t, types::glyphID> glyph; //!< custom character, usage print(glyph(0));
+typedef strong_typedef <const char*, types::ramtextID> ramtext; //!< RAM string, usage print((ramtext)buffer);
+
+/**
+ * Fixed-point decimal number: integer value with S digits after the
+ * decimal point. Formatting uses integer arithmetic only, so no float
+ * code is linked.
+ *
+ * Usage
+ * @code
+ * 	lcd.display(0, 0, decimal<1>(215)); // displays "21.5"
+ * 	lcd.printw(6, decimal<2>(-5)); // displays " -0.05"
+ * 	lcd.displayf(0, 1, PSTR("T:%5.1k"), 215L); // displays "T: 21.5"
+ * @endcode
+ */
+template <uint8_t S>
+struct decimal {
+		//! Construction from scaled value, i.e. decimal<2>(1234) is 12.34
+		decimal(long value)
+				: value(value) {
+		}
+
+		//! The scaled value.
+		long value;
+};
+
+/**
+ * Fixed width number for myLCD::line(), right aligned.
+ * Created by pad(width, value), usage
+ * @code lcd.line(0, 1, 16, F("T:"), pad(6, decimal<1>(temp)), 'C'); @endcode
+ */
+template <typename T>
+struct padded {
+		T value;
+		uint8_t width;
+		char symbol; //!< padding symbol
+};
+
+/**
+ * Fixed width number for myLCD::line()
+ * @param width
+ * @param value integer or decimal
+ * @param symbol padding symbol
+ */
+template <typename T>
+inline padded <T> pad(uint8_t width, T value, char symbol = ' ') {
+	padded <T> p = { value, width, symbol };
+	return p;
+}
+
+/**
+ * Glyph atlas entry in PROGMEM, generated by tools/atlas.py. The bitmap
+ * is the base glyph with the rows marked in mask replaced by delta rows,
+ * identical glyphs share the entry. Usage
+ * @code lcd.createChar(0, BATTERY3); @endcode
+ */
+struct myGlyph {
+		const byte *base; //!< PROGMEM base bitmap, 8 bytes
+		const byte *delta; //!< PROGMEM replacement rows, one per bit of mask
+		uint8_t mask; //!< bit n set if row n comes from delta
+};
 
 #define PAD_RIGHT 1
 #define PAD_ZERO 2
 #define SCROLLTIME 300
 
+#ifndef MYLCD_COLS
+#define MYLCD_COLS 20 //!< largest supported display width (size of the screen copy)
+#endif
+#ifndef MYLCD_ROWS
+#define MYLCD_ROWS 4 //!< largest supported display height (size of the screen copy)
+#endif
+#ifndef MYLCD_WINDOWS
+#define MYLCD_WINDOWS 0 //!< window stack depth, 0 disables windows
+#endif
+#ifndef MYLCD_WINDOWBUFFER
+#define MYLCD_WINDOWBUFFER 40 //!< bytes for the saved cells under all windows (max 255)
+#endif
+#ifndef MIRROR_RESYNC
+#define MIRROR_RESYNC 10000 //!< milliseconds between full mirror frames
+#endif
+#define MIRROR_DISPLAY 0x01 //!< mirror state: display on
+#define MIRROR_CURSOR 0x02 //!< mirror state: underline cursor
+#define MIRROR_BLINK 0x04 //!< mirror state: blinking cursor
+#define MIRROR_BACKLIGHT 0x08 //!< mirror state: backlight on
+#if defined(MYLCD_MIRROR) && MYLCD_COLS * MYLCD_ROWS > 128
+#error "Mirror supports up to 128 cells"
+#endif
+#ifndef MYLCD_REFRESH
+#define MYLCD_REFRESH 0 //!< number of refresh regions, 0 writes to display immediately
+#endif
+#ifndef REFRESH_BUDGET
+#define REFRESH_BUDGET 1000 //!< microseconds of display output per refresh()
+#endif
+#ifndef REFRESH_STALENESS
+#define REFRESH_STALENESS 1000 //!< milliseconds, maximum staleness of cells outside regions
+#endif
+#if MYLCD_REFRESH > 0 && MYLCD_COLS * MYLCD_ROWS > 255
+#error "refresh supports at most 255 cells, reduce MYLCD_COLS or MYLCD_ROWS"
+#endif
+#if MYLCD_WINDOWS > 0 || defined(MYLCD_MIRROR) || MYLCD_REFRESH > 0
+#define MYLCD_SCREEN //!< keep copy of the screen contents in RAM
+#endif
+#define NO_DEADLINE 0xFFFFFFFF //!< nextDeadline(): nothing is scheduled
+
+/**
+ * Timer of the library's time-driven behaviour (scrolling, animations,
+ * mirror flushes). Timers are kept in one list sorted by due time, see
+ * myLCD::schedule() and myLCD::nextDeadline().
+ */
+class myTimer {
+	public:
+		myTimer()
+				: _deadline(0), _link(NULL), _queued(false), _pass(0) {
+		}
+		/**
+		 * Called from myLCD::service() when the timer is due. The timer is
+		 * removed from the list before the call, reschedule it if needed;
+		 * it fires again from the next service() call at the earliest.
+		 * @param now millis() of the service call
+		 */
+		virtual void fire(unsigned long now) = 0;
+		/**
+		 * @return true if the timer is scheduled
+		 */
+		boolean queued() const {
+			return _queued;
+		}
+
+	protected:
+		/**
+		 * Timer must be cancelled before it is destroyed, derived classes
+		 * do it in their destructor.
+		 */
+		virtual ~myTimer() {
+		}
+
+	private:
+		friend class myLCD;
+		unsigned long _deadline;
+		myTimer *_link;
+		boolean _queued;
+		uint8_t _pass; //!< service() pass that scheduled the timer
+};
+
+#if MYLCD_REFRESH > 0
+/**
+ * Measurements of the deferred refresh, see myLCD::refreshStats()
+ */
+struct myRefreshStats {
+		unsigned long loops; //!< refresh() calls
+		unsigned long used; //!< microseconds spent in refresh()
+		unsigned long bytes; //!< bytes sent to display
+		uint16_t worst; //!< longest refresh() in microseconds
+		uint16_t exhausted; //!< refresh() calls that ran out of budget
+		uint16_t misses; //!< region updates shown later than the region's staleness
+		uint16_t late; //!< worst staleness of a shown update in milliseconds
+};
+#endif
+
 class myLCD: public LiquidCrystal {
 	public:
 		// construct
@@ -119,8 +281,40 @@ class myLCD: public LiquidCrystal {
 		 */
 		myLCD(uint8_t rs, uint8_t enable, uint8_t d0, uint8_t d1, uint8_t d2,
 				uint8_t d3)
-				: _numcols(0), LiquidCrystal(rs, enable, d0, d1, d2, d3) {
+				: _numcols(0), _col(0), _row(0), _cgram(false), _cgaddr(0), LiquidCrystal(rs, enable, d0, d1, d2, d3) {
 			scrollStart = millis();
+			_timers = NULL;
+			_pass = 0;
+			_scroller.lcd = this;
+#ifdef MYLCD_SCREEN
+			memset(_screen, ' ', sizeof(_screen));
+#endif
+#if MYLCD_WINDOWS > 0
+			_windows = 0;
+			_skip = false;
+#endif
+#ifdef MYLCD_MIRROR
+			_mirrorTimer.lcd = this;
+			_mirror = NULL;
+			_pending = false;
+			_flags = MIRROR_DISPLAY;
+			_glyphDirty = 0;
+			memset(_dirty, 0, sizeof(_dirty));
+			memset(_glyphs, 0, sizeof(_glyphs));
+#endif
+#if MYLCD_REFRESH > 0
+			memset(_stale, 0, sizeof(_stale));
+			_regions = 0;
+			_region[0].col = _region[0].row = 0;
+			_region[0].cols = MYLCD_COLS;
+			_region[0].rows = MYLCD_ROWS;
+			_region[0].priority = 0xFF;
+			_region[0].staleness = REFRESH_STALENESS;
+			_region[0].stale = false;
+			_refreshTimer.lcd = this;
+			_transfer = 250; // 4-bit bus: two enable pulses of 100 us each and the pin writes
+			refreshBudget(REFRESH_BUDGET);
+#endif
 		}
 		;
 		template <typename T>
@@ -158,6 +352,8 @@ class myLCD: public LiquidCrystal {
 		void center(byte line, const String &text);
 
 		void clean(byte col, byte row, byte rept);
+		template <typename ... Args>
+		size_t line(byte col, byte row, byte width, Args ... args);
 		/**
 		 * Extends usage
 		 * @code lcd.begin(16,2);
@@ -169,13 +365,100 @@ class myLCD: public LiquidCrystal {
 		void begin(uint8_t cols, uint8_t rows, uint8_t charsize = LCD_5x8DOTS) {
 			LiquidCrystal::begin(cols, rows, charsize);
 			_numcols = cols;
+			_col = _row = 0;
+			_cgram = false;
+#ifdef MYLCD_SCREEN
+			_blank();
+#endif
+#if MYLCD_WINDOWS > 0
+			_windows = 0;
+#endif
+#if MYLCD_REFRESH > 0
+			memset(_stale, 0, sizeof(_stale)); // display was cleared
+			for (uint8_t i = 0; i <= _regions; ++i) {
+				_region[i].stale = false;
+			}
+			cancel(_refreshTimer);
+#endif
 		}
+		void setCursor(uint8_t col, uint8_t row);
+		void clear();
+		void home();
+		virtual size_t write(uint8_t value);
+		using LiquidCrystal::write;
 		/**
 		 * Create custom character from PROGMEM
 		 * @param location
 		 * @param charDef
 		 */
 		void createChar(uint8_t location, const byte *charDef);
+		void createChar(uint8_t location, ram charDef);
+		void createChar(uint8_t location, const myGlyph *glyph);
+		void selectChar(uint8_t location, uint8_t row = 0);
+		void restoreCursor();
+		size_t updateChar(uint8_t location, uint8_t row, byte bits, byte old);
+		size_t updateDone(size_t sent);
+
+#if MYLCD_WINDOWS > 0
+		boolean pushWindow(byte col, byte row, byte cols, byte rows);
+		void popWindow();
+#endif
+
+		/**
+		 * Turns the display on (LiquidCrystal::display is hidden by display templates)
+		 */
+		void display() {
+#ifdef MYLCD_MIRROR
+			_flags |= MIRROR_DISPLAY;
+#endif
+			LiquidCrystal::display();
+		}
+#ifdef MYLCD_MIRROR
+		void noDisplay() {
+			_flags &= ~MIRROR_DISPLAY;
+			LiquidCrystal::noDisplay();
+		}
+		void cursor() {
+			_flags |= MIRROR_CURSOR;
+			LiquidCrystal::cursor();
+		}
+		void noCursor() {
+			_flags &= ~MIRROR_CURSOR;
+			LiquidCrystal::noCursor();
+		}
+		void blink() {
+			_flags |= MIRROR_BLINK;
+			LiquidCrystal::blink();
+		}
+		void noBlink() {
+			_flags &= ~MIRROR_BLINK;
+			LiquidCrystal::noBlink();
+		}
+
+		void mirror(Print &out, uint16_t interval);
+		size_t mirrorUpdate();
+		void mirrorResync();
+		void mirrorBacklight(boolean on);
+		/**
+		 * @return bytes sent to mirror since mirror() (for measuring the stream)
+		 */
+		unsigned long mirrorBytes() const {
+			return _mirrorBytes;
+		}
+#endif
+
+#if MYLCD_REFRESH > 0
+		int8_t refreshRegion(byte col, byte row, byte cols, byte rows, uint8_t priority, uint16_t staleness);
+		void refreshBudget(uint16_t us);
+		size_t refresh();
+		boolean refreshPending() const;
+		/**
+		 * @return measurements since refreshBudget() (for sizing the budget)
+		 */
+		const myRefreshStats &refreshStats() const {
+			return _stats;
+		}
+#endif
 
 		/**
 		 * Scrolls text in custom location
@@ -185,6 +468,8 @@ class myLCD: public LiquidCrystal {
 		 * @param len scroll lenght
 		 */
 		void scroll(byte col, byte row, const PROGMEM char *text, byte len);
+		void startScroll(byte col, byte row, const PROGMEM char *text, byte len);
+		void stopScroll();
 		void scroll(byte col, byte row, const PROGMEM char *text[], byte len);
 
 		using Print::print;
@@ -195,7 +480,29 @@ class myLCD: public LiquidCrystal {
 
 		size_t printw(uint8_t width, const PROGMEM char *text, boolean padleft, const char symbol); //!< text
 		size_t printw(uint8_t width, int value, boolean padleft, const char symbol); //!< integer
+#ifndef MYLCD_NOFLOAT
 		size_t printw(uint8_t width, double value, uint8_t digits, boolean padleft, const char symbol); //!< float
+#else
+		size_t printw(uint8_t width, double value, uint8_t digits, boolean padleft = false, const char symbol = ' ') = delete; //!< use decimal
+		void display(byte pos, byte line, double n, int digits) = delete; //!< use decimal
+		void display(byte pos, byte line, float n, int digits) = delete; //!< use decimal
+		void display(byte pos, byte line, double text) = delete; //!< use decimal
+		void display(byte pos, byte line, float text) = delete; //!< use decimal
+		size_t print(double n, int digits = 2) = delete; //!< use decimal
+		using Print::println;
+		size_t println(double n, int digits = 2) = delete; //!< use decimal
+#endif
+		template <uint8_t S>
+		size_t printw(uint8_t width, decimal <S> value, boolean padleft = false, const char symbol = ' '); //!< fixed-point
+
+		template <uint8_t S>
+		size_t print(decimal <S> value);
+		template <typename T>
+		size_t print(padded <T> value);
+		template <uint8_t S>
+		size_t print(padded <decimal <S> > value);
+		size_t print(glyph location);
+		size_t print(ramtext text);
 
 //		size_t print(const PROGMEM char *text, uint8_t len);
 //		size_t print(upper text, uint8_t len);
@@ -209,6 +516,11 @@ class myLCD: public LiquidCrystal {
 
 		/* assuming sizeof(void *) == sizeof(int) */
 		size_t printf(const PROGMEM char *format, ...);
+		void schedule(myTimer &timer, unsigned long due);
+		void cancel(myTimer &timer);
+		unsigned long nextDeadline();
+		boolean service();
+
 		size_t _printf(const char *format, va_list args);
 		void displayf(byte col, byte row, const PROGMEM char *format, ...);
 
@@ -216,11 +528,117 @@ class myLCD: public LiquidCrystal {
 		//size_t _printf(const PROGMEM char **out, int *varg);
 		void _clean(byte width, byte len, uint8_t value);
 		uint8_t len(long value);
+#ifndef MYLCD_NOFLOAT
 		uint8_t len(double value, byte digits);
+#endif
+		uint8_t _len(long value, uint8_t scale);
+		size_t _print(long value, uint8_t scale);
+		size_t _printw(uint8_t width, long value, uint8_t scale, boolean padleft, const char symbol);
+		uint8_t _width();
+		size_t _compose();
+		template <typename T, typename ... Args>
+		size_t _compose(T first, Args ... rest);
+#ifdef MYLCD_SCREEN
+		void _cell(uint8_t row, uint8_t col, char value);
+		void _blank();
+#endif
+#if MYLCD_REFRESH > 0
+		struct region {
+				uint8_t col;
+				uint8_t row;
+				uint8_t cols;
+				uint8_t rows;
+				uint8_t priority; //!< 0 is the most urgent
+				boolean stale; //!< region has unsent cells
+				uint16_t staleness; //!< milliseconds
+				unsigned long since; //!< time of the first unsent change
+		};
+		void _touch(uint8_t row, uint8_t col);
+		void _refreshWake();
+		boolean _send(region &g, unsigned long start, size_t &n);
+#endif
+#ifdef MYLCD_MIRROR
+		uint8_t _mirrorFrame(boolean send, uint8_t &sum);
+		void _mirrorSend(uint8_t value, uint8_t &sum);
+		void _mirrorWake();
+#endif
 
 		uint8_t _numcols;
+		uint8_t _col; //!< cursor column as known to the library
+		uint8_t _row; //!< cursor row as known to the library
+		boolean _cgram; //!< address counter points to CGRAM
+		uint8_t _cgaddr; //!< CGRAM address counter
 		unsigned long scrollStart;
-//		byte screen[32];
+		myTimer *_timers; //!< scheduled timers, earliest first
+		uint8_t _pass; //!< counts service() calls
+
+		class scrollTimer: public myTimer {
+			public:
+				void fire(unsigned long);
+				myLCD *lcd;
+				const char *text;
+				byte col;
+				byte row;
+				byte len;
+		} _scroller; //!< steps startScroll() from service()
+#ifdef MYLCD_SCREEN
+		char _screen[MYLCD_ROWS][MYLCD_COLS]; //!< screen contents
+#endif
+#if MYLCD_WINDOWS > 0
+		struct window {
+				uint8_t col; //!< left edge on screen
+				uint8_t row; //!< top edge on screen
+				uint8_t cols;
+				uint8_t rows;
+				uint8_t curcol; //!< cursor before window was pushed
+				uint8_t currow;
+				uint8_t start; //!< saved cells in _saved
+		};
+		window _window[MYLCD_WINDOWS];
+		uint8_t _windows; //!< number of windows in stack
+		boolean _skip; //!< characters were clipped, address counter is behind the cursor
+		char _saved[MYLCD_WINDOWBUFFER];
+#endif
+#if MYLCD_REFRESH > 0
+		byte _stale[(MYLCD_COLS * MYLCD_ROWS + 7) / 8]; //!< cells not sent to display yet
+		region _region[MYLCD_REFRESH + 1]; //!< regions, the last one covers cells outside of regions
+		uint8_t _regions; //!< number of regions
+		uint16_t _budget; //!< microseconds per refresh()
+		uint16_t _transfer; //!< measured microseconds per byte
+		myRefreshStats _stats;
+
+		class refreshTimer: public myTimer {
+			public:
+				void fire(unsigned long) {
+					lcd->refresh();
+				}
+				myLCD *lcd;
+		} _refreshTimer; //!< refreshes from service() when a region gets stale
+#endif
+#ifdef MYLCD_MIRROR
+		Print *_mirror; //!< mirror stream or NULL
+		byte _dirty[(MYLCD_COLS * MYLCD_ROWS + 7) / 8]; //!< cells changed since last frame
+		byte _glyphs[64]; //!< CGRAM contents
+		uint8_t _glyphDirty; //!< custom characters changed since last frame
+		uint8_t _flags; //!< display, cursor, blink and backlight state
+		uint8_t _sentFlags; //!< state in mirror
+		uint8_t _sentCursor; //!< cursor address in mirror
+		uint8_t _seq; //!< frame sequence number
+		boolean _full; //!< next frame is full resync
+		boolean _pending; //!< mirror timer is set to the next flush
+		uint16_t _mirrorInterval;
+		unsigned long _mirrorDue;
+		unsigned long _resyncDue;
+		unsigned long _mirrorBytes;
+
+		class mirrorTimer: public myTimer {
+			public:
+				void fire(unsigned long) {
+					lcd->mirrorUpdate();
+				}
+				myLCD *lcd;
+		} _mirrorTimer; //!< flushes mirror from service()
+#endif
 };
 
 /**
@@ -258,31 +676,31 @@ inline void myLCD::center(byte line, const __FlashStringHelper *text) {
 //		--i;
 //	}
 	int len = strlen_P((PGM_P) text);
-	int pos = max((_numcols - len) / 2, 0);
+	int pos = max((_width() - len) / 2, 0);
 	this->display(pos, line, text);
 }
 
 inline void myLCD::center(byte line, const char* text) {
 	int len = strlen_P(text); // strlen if we are not using PROGMEM
-	int pos = max((_numcols - len) / 2, 0);
+	int pos = max((_width() - len) / 2, 0);
 	this->display(pos, line, text);
 }
 
 inline void myLCD::center(byte line, upper text) {
 	int len = strlen_P(text); // strlen if we are not using PROGMEM
-	int pos = max((_numcols - len) / 2, 0);
+	int pos = max((_width() - len) / 2, 0);
 	this->display(pos, line, text);
 }
 
 inline void myLCD::center(byte line, lower text) {
 	int len = strlen_P(text); // strlen if we are not using PROGMEM
-	int pos = max((_numcols - len) / 2, 0);
+	int pos = max((_width() - len) / 2, 0);
 	this->display(pos, line, text);
 }
 
 inline void myLCD::center(byte line, const String& text) {
 	int len = text.length();
-	int pos = max((_numcols - len) / 2, 0);
+	int pos = max((_width() - len) / 2, 0);
 	this->display(pos, line, text);
 }
 
@@ -343,16 +761,692 @@ inline size_t myLCD::print(lower text) {
 }
 
 /**
- * Progmem char
+ * Progmem char. Cursor position is kept, so the text can be continued
+ * after createChar without setCursor.
  */
 inline void myLCD::createChar(uint8_t location, const byte *charDef) {
-	location &= 0x7; // we only have 8 locations 0-7
-	command(LCD_SETCGRAMADDR | (location << 3));
+	selectChar(location);
 	for (byte i = 0; i < 8; i++) {
 		write(pgm_read_byte(charDef++));
 	}
+	restoreCursor();
+}
+
+/**
+ * Create custom character from RAM bitmap
+ * @code lcd.createChar(0, (ram)bitmap); @endcode
+ * @param location
+ * @param charDef
+ */
+inline void myLCD::createChar(uint8_t location, ram charDef) {
+	const byte *p = charDef;
+	selectChar(location);
+	for (byte i = 0; i < 8; i++) {
+		write(*p++);
+	}
+	restoreCursor();
 }
 
+/**
+ * Create custom character from glyph atlas. Bitmap is decoded while
+ * uploading, nothing is copied to RAM.
+ * @param location
+ * @param glyph PROGMEM atlas entry
+ */
+inline void myLCD::createChar(uint8_t location, const myGlyph *glyph) {
+	const byte *base = (const byte*) pgm_read_word(&glyph->base);
+	const byte *delta = (const byte*) pgm_read_word(&glyph->delta);
+	uint8_t mask = pgm_read_byte(&glyph->mask);
+	selectChar(location);
+	for (byte i = 0; i < 8; i++, mask >>= 1) {
+		write(pgm_read_byte((mask & 1) ? delta++ : base + i));
+	}
+	restoreCursor();
+}
+
+/**
+ * Sets CGRAM address. Following write() calls upload bitmap rows until
+ * restoreCursor() or setCursor() is called.
+ * @param location Custom character 0-7
+ * @param row Bitmap row 0-7
+ */
+inline void myLCD::selectChar(uint8_t location, uint8_t row) {
+	location &= 0x7; // we only have 8 locations 0-7
+	command(LCD_SETCGRAMADDR | (location << 3) | (row & 0x7));
+	_cgram = true;
+	_cgaddr = (location << 3) | (row & 0x7);
+}
+
+/**
+ * Uploads bitmap row if it differs from the old one. Consecutive changed
+ * rows are written in one run, as CGRAM address increments automatically.
+ * Call updateDone() after the last row.
+ * @param location Custom character 0-7
+ * @param row Bitmap row 0-7
+ * @param bits New row
+ * @param old Row currently in CGRAM
+ * @return number of bytes sent to display
+ */
+inline size_t myLCD::updateChar(uint8_t location, uint8_t row, byte bits, byte old) {
+	if (bits == old) return 0;
+	size_t n = 1;
+	uint8_t addr = ((location & 0x7) << 3) | (row & 0x7);
+	if (!_cgram || _cgaddr != addr) {
+		selectChar(location, row);
+		++n;
+	}
+	write(bits);
+	return n;
+}
+
+/**
+ * Ends updateChar() rows, restores the cursor if anything was sent
+ * @param sent Bytes sent by updateChar()
+ * @return bytes sent including the cursor restore
+ */
+inline size_t myLCD::updateDone(size_t sent) {
+	if (sent == 0) return 0;
+	restoreCursor();
+	return sent + 1;
+}
+
+/**
+ * Points address counter back to the cursor position (DDRAM)
+ */
+inline void myLCD::restoreCursor() {
+	_cgram = false;
+#if MYLCD_WINDOWS > 0
+	_skip = false;
+#endif
+	LiquidCrystal::setCursor(_col, _row);
+}
+
+/**
+ * Tracks cursor position in order to restore it after CGRAM access.
+ * Inside window the position is relative to the window.
+ */
+inline void myLCD::setCursor(uint8_t col, uint8_t row) {
+#if MYLCD_WINDOWS > 0
+	if (_windows > 0) {
+		col += _window[_windows - 1].col;
+		row += _window[_windows - 1].row;
+	}
+	_skip = false;
+#endif
+	_col = col;
+	_row = row;
+	_cgram = false;
+#if MYLCD_REFRESH == 0
+	LiquidCrystal::setCursor(col, row);
+#endif
+}
+
+/**
+ * Clears the screen, inside window clears the window only
+ */
+inline void myLCD::clear() {
+#if MYLCD_WINDOWS > 0
+	if (_windows > 0) {
+		window &w = _window[_windows - 1];
+		for (byte r = 0; r < w.rows; ++r) {
+			setCursor(0, r);
+			for (byte c = 0; c < w.cols; ++c) {
+				write(' ');
+			}
+		}
+		setCursor(0, 0);
+		return;
+	}
+#endif
+#if MYLCD_REFRESH == 0 // changed cells are sent by refresh()
+	LiquidCrystal::clear();
+#endif
+	_col = _row = 0;
+	_cgram = false;
+#ifdef MYLCD_SCREEN
+	_blank();
+#endif
+}
+
+inline void myLCD::home() {
+#if MYLCD_REFRESH == 0
+	LiquidCrystal::home();
+#endif
+	_col = _row = 0;
+	_cgram = false;
+}
+
+/**
+ * Writes character (DDRAM) or bitmap row (CGRAM)
+ * @param value
+ * @return 1
+ */
+inline size_t myLCD::write(uint8_t value) {
+	if (_cgram) {
+		uint8_t a = _cgaddr;
+		_cgaddr = (a + 1) & 0x3F;
+#ifdef MYLCD_MIRROR
+		if (_glyphs[a] != value) {
+			_glyphs[a] = value;
+			_glyphDirty |= 1 << (a >> 3);
+			_mirrorWake();
+		}
+#endif
+		return LiquidCrystal::write(value);
+	}
+#if MYLCD_WINDOWS > 0
+	if (_windows > 0) {
+		window &w = _window[_windows - 1];
+		if (_col < w.col || _col >= w.col + w.cols || _row < w.row || _row >= w.row + w.rows) { // clipped
+			++_col;
+			_skip = true;
+			return 1;
+		}
+#if MYLCD_REFRESH == 0
+		if (_skip) {
+			LiquidCrystal::setCursor(_col, _row);
+			_skip = false;
+		}
+#endif
+	}
+#endif
+#ifdef MYLCD_SCREEN
+	if (_col < MYLCD_COLS && _row < MYLCD_ROWS) _cell(_row, _col, value);
+#endif
+	++_col;
+#if MYLCD_REFRESH > 0
+	return 1; // sent by refresh()
+#else
+	return LiquidCrystal::write(value);
+#endif
+}
+
+#ifdef MYLCD_SCREEN
+/**
+ * Stores character in the screen copy
+ */
+inline void myLCD::_cell(uint8_t row, uint8_t col, char value) {
+	char &cell = _screen[row][col];
+#if defined(MYLCD_MIRROR) || MYLCD_REFRESH > 0
+	if (cell != value) {
+		uint8_t i = row * MYLCD_COLS + col;
+#ifdef MYLCD_MIRROR
+		_dirty[i >> 3] |= 1 << (i & 7);
+		_mirrorWake();
+#endif
+#if MYLCD_REFRESH > 0
+		_stale[i >> 3] |= 1 << (i & 7);
+		_touch(row, col);
+#endif
+	}
+#endif
+	cell = value;
+}
+
+/**
+ * Fills the screen copy with spaces
+ */
+inline void myLCD::_blank() {
+	for (uint8_t r = 0; r < MYLCD_ROWS; ++r) {
+		for (uint8_t c = 0; c < MYLCD_COLS; ++c) {
+			_cell(r, c, ' ');
+		}
+	}
+}
+#endif
+
+/**
+ * Width of the screen or the window
+ */
+inline uint8_t myLCD::_width() {
+#if MYLCD_WINDOWS > 0
+	if (_windows > 0) return _window[_windows - 1].cols;
+#endif
+	return _numcols;
+}
+
+#if MYLCD_WINDOWS > 0
+/**
+ * Opens window (modal popup). Until popWindow(), cursor positions are
+ * relative to the window and all output is clipped to its bounds; clear()
+ * and center() work on the window. Screen contents under the window are
+ * saved, use clear() to blank the window. Nested window is positioned
+ * relative to the current window and clipped to it.
+ *
+ * Requires MYLCD_WINDOWS (stack depth) to be defined before including
+ * the library, saved cells of all open windows must fit into
+ * MYLCD_WINDOWBUFFER bytes.
+ *
+ * @code
+ * 	#define MYLCD_WINDOWS 2
+ * 	#include "mylcd.h"
+ * 	...
+ * 	lcd.pushWindow(2, 1, 12, 2);
+ * 	lcd.clear();
+ * 	lcd.center(0, F("ALARM"));
+ * 	lcd.displayf(0, 1, PSTR("T=%5.1k"), temp);
+ * 	...
+ * 	lcd.popWindow(); // restores the screen under the window
+ * @endcode
+ *
+ * @param col Left edge
+ * @param row Top edge
+ * @param cols Window width
+ * @param rows Window height
+ * @return false if the stack or buffer is full or the window is outside
+ */
+inline boolean myLCD::pushWindow(byte col, byte row, byte cols, byte rows) {
+	if (_windows >= MYLCD_WINDOWS) return false;
+	byte right = MYLCD_COLS, bottom = MYLCD_ROWS;
+	uint8_t start = 0;
+	if (_windows > 0) { // nested window is relative to the top window and clipped by it
+		window &prev = _window[_windows - 1];
+		if (col >= prev.cols || row >= prev.rows) return false;
+		col += prev.col;
+		row += prev.row;
+		right = prev.col + prev.cols;
+		bottom = prev.row + prev.rows;
+		start = prev.start + prev.cols * prev.rows;
+	}
+	if (col >= right || row >= bottom) return false;
+	cols = min(cols, (byte) (right - col));
+	rows = min(rows, (byte) (bottom - row));
+	if (start + cols * rows > MYLCD_WINDOWBUFFER) return false;
+
+	window &w = _window[_windows++];
+	w.col = col;
+	w.row = row;
+	w.cols = cols;
+	w.rows = rows;
+	w.curcol = _col;
+	w.currow = _row;
+	w.start = start;
+	char *saved = _saved + start;
+	for (byte r = 0; r < rows; ++r) {
+		memcpy(saved, &_screen[row + r][col], cols);
+		saved += cols;
+	}
+	setCursor(0, 0);
+	return true;
+}
+
+/**
+ * Closes the topmost window. Only the cells that differ from the saved
+ * contents are rewritten, the cursor is moved back where it was before
+ * pushWindow().
+ */
+inline void myLCD::popWindow() {
+	if (_windows == 0) return;
+	window &w = _window[--_windows];
+	const char *saved = _saved + w.start;
+	for (byte r = 0; r < w.rows; ++r) {
+#if MYLCD_REFRESH == 0
+		boolean run = false;
+#endif
+		char *cell = &_screen[w.row + r][w.col];
+		for (byte c = 0; c < w.cols; ++c, ++cell, ++saved) {
+			if (*cell == *saved) {
+#if MYLCD_REFRESH == 0
+				run = false;
+#endif
+				continue;
+			}
+#if MYLCD_REFRESH == 0
+			if (!run) {
+				LiquidCrystal::setCursor(w.col + c, w.row + r);
+				run = true;
+			}
+			LiquidCrystal::write(*saved);
+#endif
+			_cell(w.row + r, w.col + c, *saved);
+		}
+	}
+	_col = w.curcol;
+	_row = w.currow;
+	restoreCursor();
+}
+#endif
+
+#ifdef MYLCD_MIRROR
+/**
+ * Starts mirroring the display contents to stream (i.e. Serial). Define
+ * MYLCD_MIRROR before including the library. The first frame is a full
+ * resync, then only changes are sent, at most every interval ms; full
+ * frame is repeated every MIRROR_RESYNC ms. Call mirrorUpdate() from loop().
+ *
+ * Frame: 0xFE, sequence, payload length, payload, payload sum (mod 256).
+ * Payload records:
+ * - 0xA0 cols rows: full resync, all cells and glyphs follow
+ * - address(0x00-0x7F) length chars...: cell run, address is row * cols + col
+ * - 0x80 + location, 8 bytes: custom character bitmap
+ * - 0x90 flags cursor: state (bit 0 display, 1 cursor, 2 blink, 3 backlight) and cursor address
+ *
+ * tools/mirror.py decodes the stream on the host.
+ *
+ * @param out Stream
+ * @param interval Minimum milliseconds between frames
+ */
+inline void myLCD::mirror(Print &out, uint16_t interval) {
+	_mirror = &out;
+	_mirrorInterval = interval;
+	_mirrorBytes = 0;
+	_seq = 0;
+	_mirrorDue = millis();
+	mirrorResync();
+}
+
+/**
+ * Sends full frame with the next mirrorUpdate()
+ */
+inline void myLCD::mirrorResync() {
+	_full = true;
+	_resyncDue = millis() + MIRROR_RESYNC;
+	_mirrorWake();
+}
+
+/**
+ * Schedules mirror flush after change. Without changes the mirror timer
+ * only waits for the next full resync.
+ */
+inline void myLCD::_mirrorWake() {
+	if (_pending || _mirror == NULL) return;
+	_pending = true;
+	schedule(_mirrorTimer, _mirrorDue);
+}
+
+/**
+ * Backlight is not driven by this library, report its state to mirror
+ * @param on
+ */
+inline void myLCD::mirrorBacklight(boolean on) {
+	if (on) _flags |= MIRROR_BACKLIGHT;
+	else _flags &= ~MIRROR_BACKLIGHT;
+	_mirrorWake();
+}
+
+/**
+ * Sends changes since the previous frame, if the interval has passed
+ * @return number of bytes sent
+ */
+inline size_t myLCD::mirrorUpdate() {
+	if (_mirror == NULL) return 0;
+	unsigned long now = millis();
+	if ((long) (now - _mirrorDue) < 0) return 0;
+	_mirrorDue = now + _mirrorInterval;
+	if ((long) (now - _resyncDue) >= 0) mirrorResync();
+	_pending = false;
+	schedule(_mirrorTimer, _resyncDue);
+
+	if (_full) {
+		memset(_dirty, 0xFF, sizeof(_dirty));
+		_glyphDirty = 0xFF;
+	}
+	uint8_t sum = 0;
+	uint8_t len = _mirrorFrame(false, sum);
+	if (len == 0) return 0;
+
+	_mirror->write(0xFE);
+	_mirror->write(++_seq);
+	_mirror->write(len);
+	_mirrorFrame(true, sum);
+	_mirror->write(sum);
+	_full = false;
+	_mirrorBytes += len + 4;
+	return len + 4;
+}
+
+inline void myLCD::_mirrorSend(uint8_t value, uint8_t &sum) {
+	_mirror->write(value);
+	sum += value;
+}
+
+/**
+ * Builds frame payload. The first pass only counts the bytes, so no
+ * frame buffer is needed.
+ *
+ * @param send Send the payload and clear the changes
+ * @param sum Payload checksum
+ * @return payload length
+ */
+inline uint8_t myLCD::_mirrorFrame(boolean send, uint8_t &sum) {
+	uint8_t len = 0;
+	if (_full) {
+		len += 3;
+		if (send) {
+			_mirrorSend(0xA0, sum);
+			_mirrorSend(MYLCD_COLS, sum);
+			_mirrorSend(MYLCD_ROWS, sum);
+		}
+	}
+
+	// changed cell runs, up to 2 unchanged cells are cheaper to send within the run
+	const uint8_t cells = MYLCD_COLS * MYLCD_ROWS;
+	const char *screen = &_screen[0][0];
+	uint8_t i = 0;
+	while (i < cells) {
+		if (!(_dirty[i >> 3] & (1 << (i & 7)))) {
+			++i;
+			continue;
+		}
+		uint8_t end = i + 1;
+		for (uint8_t j = end; j < cells && j < end + 3; ++j) {
+			if (_dirty[j >> 3] & (1 << (j & 7))) end = j + 1;
+		}
+		len += 2 + end - i;
+		if (send) {
+			_mirrorSend(i, sum);
+			_mirrorSend(end - i, sum);
+			for (uint8_t k = i; k < end; ++k) {
+				_mirrorSend(screen[k], sum);
+				_dirty[k >> 3] &= ~(1 << (k & 7));
+			}
+		}
+		i = end;
+	}
+
+	for (uint8_t slot = 0; slot < 8; ++slot) {
+		if (!(_glyphDirty & (1 << slot))) continue;
+		len += 9;
+		if (send) {
+			_mirrorSend(0x80 | slot, sum);
+			for (uint8_t k = 0; k < 8; ++k) {
+				_mirrorSend(_glyphs[(slot << 3) + k], sum);
+			}
+		}
+	}
+	if (send) _glyphDirty = 0;
+
+	uint8_t cursor = min(_row * MYLCD_COLS + _col, cells - 1);
+	if (_full || _flags != _sentFlags || ((_flags & (MIRROR_CURSOR | MIRROR_BLINK)) && cursor != _sentCursor)) {
+		len += 3;
+		if (send) {
+			_mirrorSend(0x90, sum);
+			_mirrorSend(_flags, sum);
+			_mirrorSend(cursor, sum);
+			_sentFlags = _flags;
+			_sentCursor = cursor;
+		}
+	}
+	return len;
+}
+#endif
+
+#if MYLCD_REFRESH > 0
+/**
+ * Tags screen region with priority and maximum staleness. Define
+ * MYLCD_REFRESH (number of regions) before including the library; then
+ * all output only changes the screen copy and refresh() called from
+ * loop() sends the changed cells within the time budget, the most urgent
+ * regions first. Regions should not overlap, cells outside of regions
+ * have the lowest priority and REFRESH_STALENESS.
+ *
+ * @code
+ * 	#define MYLCD_REFRESH 2
+ * 	#include "mylcd.h"
+ * 	...
+ * 	lcd.refreshRegion(0, 0, 20, 1, 0, 100); // alarm line, priority 0, shown within 100 ms
+ * 	lcd.refreshRegion(0, 1, 20, 3, 1, 500); // values
+ * 	lcd.refreshBudget(800); // 800 us per loop
+ * 	...
+ * 	void loop(){
+ * 		lcd.refresh();
+ * 	}
+ * @endcode
+ *
+ * @param col Left edge
+ * @param row Top edge
+ * @param cols Region width
+ * @param rows Region height
+ * @param priority 0 is the most urgent
+ * @param staleness Milliseconds, later updates are counted as deadline misses
+ * @return region number or -1 if all MYLCD_REFRESH regions are used
+ */
+inline int8_t myLCD::refreshRegion(byte col, byte row, byte cols, byte rows, uint8_t priority, uint16_t staleness) {
+	if (_regions >= MYLCD_REFRESH || col >= MYLCD_COLS || row >= MYLCD_ROWS) return -1;
+	_region[_regions + 1] = _region[_regions]; // cells outside of regions stay the last
+	region &g = _region[_regions];
+	g.col = col;
+	g.row = row;
+	g.cols = min(cols, (byte) (MYLCD_COLS - col));
+	g.rows = min(rows, (byte) (MYLCD_ROWS - row));
+	g.priority = priority;
+	g.staleness = staleness;
+	g.stale = false;
+	return _regions++;
+}
+
+/**
+ * Sets time budget per refresh() and clears the measurements
+ * @param us Microseconds, at least one cell is sent per refresh()
+ */
+inline void myLCD::refreshBudget(uint16_t us) {
+	_budget = us;
+	memset(&_stats, 0, sizeof(_stats));
+}
+
+/**
+ * @return true if some changes are not shown yet
+ */
+inline boolean myLCD::refreshPending() const {
+	for (uint8_t i = 0; i <= _regions; ++i) {
+		if (_region[i].stale) return true;
+	}
+	return false;
+}
+
+/**
+ * Marks region of the changed cell stale
+ */
+inline void myLCD::_touch(uint8_t row, uint8_t col) {
+	uint8_t i = 0;
+	for (; i < _regions; ++i) {
+		region &g = _region[i];
+		if (col >= g.col && col < g.col + g.cols && row >= g.row && row < g.row + g.rows) break;
+	}
+	region &g = _region[i];
+	if (!g.stale) {
+		g.stale = true;
+		g.since = millis();
+		if (!_refreshTimer.queued() || (long) (g.since - _refreshTimer._deadline) < 0) schedule(_refreshTimer, g.since);
+	}
+}
+
+/**
+ * Schedules refresh from service() in the next millisecond while changes
+ * are pending, so the rest of an exhausted budget follows right away.
+ */
+inline void myLCD::_refreshWake() {
+	if (refreshPending()) schedule(_refreshTimer, millis() + 1);
+	else cancel(_refreshTimer);
+}
+
+/**
+ * Sends changed cells to display. Regions are sent by priority, regions
+ * of the same priority by their deadline. The next byte is not started if
+ * it would not fit into the budget (estimated from the previous calls),
+ * the rest is sent by the next refresh(). Call it from loop().
+ *
+ * The hardware cursor is left after the last sent cell. If cursor() or
+ * blink() is used, call restoreCursor() after refresh(); it moves the
+ * hardware cursor back to the cursor position known to the library.
+ *
+ * Tickless sketches need not call refresh(): service() refreshes as soon
+ * as a cell changes and every millisecond while changes are pending,
+ * nextDeadline() includes it. Staleness only orders regions of the same
+ * priority and counts misses.
+ *
+ * @return number of bytes sent to display
+ */
+inline size_t myLCD::refresh() {
+	++_stats.loops;
+	if (_cgram) { // CGRAM upload in progress
+		_refreshWake();
+		return 0;
+	}
+	unsigned long start = micros();
+	size_t n = 0;
+	for (;;) {
+		region *g = NULL;
+		for (uint8_t i = 0; i <= _regions; ++i) {
+			region &r = _region[i];
+			if (!r.stale) continue;
+			if (g == NULL || r.priority < g->priority
+					|| (r.priority == g->priority && (long) (r.since + r.staleness - g->since - g->staleness) < 0)) g = &r;
+		}
+		if (g == NULL) break;
+		if (!_send(*g, start, n)) {
+			++_stats.exhausted;
+			break;
+		}
+		g->stale = false;
+		unsigned long age = millis() - g->since;
+		if (age > g->staleness) {
+			++_stats.misses;
+			if (age > _stats.late) _stats.late = min(age, 0xFFFFUL);
+		}
+	}
+	unsigned long used = micros() - start;
+	if (n > 0) {
+		_transfer = used / n;
+		_stats.bytes += n;
+	}
+	_stats.used += used;
+	if (used > _stats.worst) _stats.worst = min(used, 0xFFFFUL);
+	_refreshWake();
+	return n;
+}
+
+/**
+ * Sends changed cells of the region, consecutive cells in one run
+ * @param g Region
+ * @param start micros() at the start of refresh()
+ * @param n Bytes sent
+ * @return false if the budget is exhausted
+ */
+inline boolean myLCD::_send(region &g, unsigned long start, size_t &n) {
+	for (uint8_t r = g.row; r < g.row + g.rows; ++r) {
+		boolean run = false;
+		for (uint8_t c = g.col; c < g.col + g.cols; ++c) {
+			uint8_t i = r * MYLCD_COLS + c;
+			if (!(_stale[i >> 3] & (1 << (i & 7)))) {
+				run = false;
+				continue;
+			}
+			if (n > 0 && micros() - start + (run ? 1 : 2) * _transfer > _budget) return false;
+			if (!run) {
+				LiquidCrystal::setCursor(c, r);
+				run = true;
+				++n;
+			}
+			LiquidCrystal::write(_screen[r][c]);
+			_stale[i >> 3] &= ~(1 << (i & 7));
+			++n;
+		}
+	}
+	return true;
+}
+#endif
+
 /**
  * Cleans screen in the pos
  * @param col Cursor Position
@@ -366,6 +1460,87 @@ inline void myLCD::clean(byte col, byte row, byte rept) {
 	}
 }
 
+/**
+ * Composes the whole line with one setCursor. Arguments can be PROGMEM
+ * strings, F() strings, String, RAM strings tagged as ramtext, upper/lower,
+ * characters, integers, decimal, pad(width, number) and glyph. Plain
+ * char* is PROGMEM string, so RAM buffers (itoa, snprintf) must be passed
+ * as (ramtext)buffer. The rest of the width is
+ * filled with spaces, so no clean() is needed for shorter values. Longer
+ * content is not truncated.
+ *
+ * @code
+ * 	lcd.line(0, 1, 16, F("T:"), pad(5, decimal<1>(temp)), F("C "), glyph(0));
+ * 	lcd.line(0, 2, 16, F("ID:"), (ramtext) itoa(id, buf, 16));
+ * @endcode
+ *
+ * @param col Cursor Position
+ * @param row Cursor Line
+ * @param width Line width to fill
+ * @param args Items
+ * @return number of characters written
+ */
+template <typename ... Args>
+inline size_t myLCD::line(byte col, byte row, byte width, Args ... args) {
+	setCursor(col, row);
+	size_t n = _compose(args...);
+	while (n < width) {
+		write(' ');
+		++n;
+	}
+	return n;
+}
+
+inline size_t myLCD::_compose() {
+	return 0;
+}
+
+template <typename T, typename ... Args>
+inline size_t myLCD::_compose(T first, Args ... rest) {
+	size_t n = print(first);
+	return n + _compose(rest...);
+}
+
+/**
+ * Print fixed width number, right aligned
+ * @param value
+ * @return length of printed text
+ */
+template <typename T>
+inline size_t myLCD::print(padded <T> value) {
+	return _printw(value.width, value.value, 0, false, value.symbol);
+}
+
+/**
+ * Print fixed width fixed-point number, right aligned. With '0' padding
+ * the sign goes before zeros.
+ * @param value
+ * @return length of printed text
+ */
+template <uint8_t S>
+inline size_t myLCD::print(padded <decimal <S> > value) {
+	return _printw(value.width, value.value.value, S, false, value.symbol);
+}
+
+/**
+ * Print custom character
+ * @param location 0-7
+ * @return 1
+ */
+inline size_t myLCD::print(glyph location) {
+	return write((uint8_t) location);
+}
+
+/**
+ * Print RAM string
+ * @code lcd.print((ramtext)buffer); @endcode
+ * @param text
+ * @return length of printed text
+ */
+inline size_t myLCD::print(ramtext text) {
+	return Print::write((const char*) text);
+}
+
 inline void myLCD::scroll(byte col, byte row, const char* text, byte lenght) {
 
 	if(millis() - scrollStart < SCROLLTIME) return;
@@ -436,6 +1611,122 @@ inline void myLCD::scroll(byte col, byte row, const char* text, byte lenght) {
 	scrollStart = millis();
 }
 
+/**
+ * Scrolls text from service(), so loop() does not need to call scroll().
+ * Scrolling continues until stopScroll(). The cursor is kept where the
+ * sketch left it; steps are skipped while a window is open.
+ * @param col Cursor Position
+ * @param row Cursor Line
+ * @param text PROGMEM text
+ * @param len scroll lenght
+ */
+inline void myLCD::startScroll(byte col, byte row, const char* text, byte len) {
+	_scroller.text = text;
+	_scroller.col = col;
+	_scroller.row = row;
+	_scroller.len = len;
+	schedule(_scroller, scrollStart + SCROLLTIME);
+}
+
+/**
+ * Stops scrolling started by startScroll()
+ */
+inline void myLCD::stopScroll() {
+	cancel(_scroller);
+}
+
+inline void myLCD::scrollTimer::fire(unsigned long now) {
+#if MYLCD_WINDOWS > 0
+	if (lcd->_windows > 0) { // ticker is covered, wait until popWindow()
+		lcd->schedule(*this, now + SCROLLTIME);
+		return;
+	}
+#endif
+	uint8_t c = lcd->_col, r = lcd->_row;
+	unsigned long last = lcd->scrollStart;
+	lcd->scroll(col, row, text, len);
+	if (lcd->scrollStart != last) { // stepped, put the cursor back
+		lcd->_col = c;
+		lcd->_row = r;
+		lcd->restoreCursor();
+	}
+	lcd->schedule(*this, lcd->scrollStart + SCROLLTIME);
+}
+
+/**
+ * Schedules (or reschedules) timer. Timers are kept sorted, so the next
+ * deadline is always the first one. Due times are compared by signed
+ * difference, so millis() overflow is handled.
+ *
+ * @param timer
+ * @param due millis() value when the timer should fire
+ */
+inline void myLCD::schedule(myTimer &timer, unsigned long due) {
+	cancel(timer);
+	timer._deadline = due;
+	myTimer **p = &_timers;
+	while (*p != NULL && (long) ((*p)->_deadline - due) <= 0)
+		p = &(*p)->_link;
+	timer._link = *p;
+	*p = &timer;
+	timer._queued = true;
+	timer._pass = _pass;
+}
+
+/**
+ * Removes timer from the list
+ * @param timer
+ */
+inline void myLCD::cancel(myTimer &timer) {
+	if (!timer._queued) return;
+	for (myTimer **p = &_timers; *p != NULL; p = &(*p)->_link) {
+		if (*p == &timer) {
+			*p = timer._link;
+			break;
+		}
+	}
+	timer._queued = false;
+}
+
+/**
+ * Time until the library needs CPU time again (scroll step, animation
+ * frame, mirror flush...). Firmware can sleep until then and call
+ * service().
+ *
+ * @code
+ * 	void loop(){
+ * 		lcd.service();
+ * 		unsigned long idle = lcd.nextDeadline();
+ * 		if (idle > 0) sleep(min(idle, 1000)); // or until button interrupt
+ * 	}
+ * @endcode
+ *
+ * @return milliseconds, 0 if something is due, NO_DEADLINE if nothing is scheduled
+ */
+inline unsigned long myLCD::nextDeadline() {
+	if (_timers == NULL) return NO_DEADLINE;
+	long left = _timers->_deadline - millis();
+	return left > 0 ? left : 0;
+}
+
+/**
+ * Runs due timers. When nothing is due, it costs one comparison.
+ * @return true if any timer was run
+ */
+inline boolean myLCD::service() {
+	if (_timers == NULL) return false;
+	unsigned long now = millis();
+	if ((long) (now - _timers->_deadline) < 0) return false;
+	uint8_t pass = ++_pass; // timers scheduled from fire() carry this pass
+	do {
+		myTimer *timer = _timers;
+		_timers = timer->_link;
+		timer->_queued = false;
+		timer->fire(now);
+	} while (_timers != NULL && (long) (now - _timers->_deadline) >= 0 && _timers->_pass != pass);
+	return true;
+}
+
 /**
  * Progmem print with text width
  * prints multiple texts from PROGMEM
@@ -663,6 +1954,10 @@ inline size_t myLCD::printf(const char *data, ...) {
  * displayf(0, 0, PSTR("%5s %4.1f %*.*f"), PSTR("Tekst"), 5.3, 2, 1, 56.3);
  * @endcode
  *
+ * Fixed-point numbers are printed with %k, argument is long scaled value
+ * and precision is the scale (%6.2k prints 1234L as " 12.34"). When
+ * MYLCD_NOFLOAT is defined, %f is not supported and prints '?'.
+ *
  * @param col
  * @param row
  * @param format
@@ -721,6 +2016,7 @@ inline size_t myLCD::_printf(const char *data, va_list args){
 
 			// float support
 			post_decimal = 0;
+			dec_width = 0;
 			while (t == '.' || (t >= '0' && t <= '9') || t == '*') {
 				if (t == '.') { // this is float
 					post_decimal = 1;
@@ -760,6 +2056,13 @@ inline size_t myLCD::_printf(const char *data, va_list args){
 				case 'u': // unsigned decimal integer
 					printw(width, *varg++, pad, padchar); // pc += printi (out, *varg++, 10, 1, width, pad, 'a');
 					break;
+				case 'k': { // fixed-point: long value, precision is the scale
+					long *lptr = (long *) varg;
+					_printw(width, *lptr++, dec_width, pad, padchar);
+					varg = (int *) lptr;
+				}
+					break;
+#ifndef MYLCD_NOFLOAT
 				case 'f': {
 #ifdef USE_NEWLIB
 					char *cptr = (char *) varg; //lint !e740 !e826  convert to double pointer
@@ -778,6 +2081,12 @@ inline size_t myLCD::_printf(const char *data, va_list args){
 					printw(width, dbl, dec_width, pad, padchar);
 				}
 					break;
+#else
+				case 'f': // no float support: skip the argument
+					varg += sizeof(double) / sizeof(int);
+					write('?');
+					break;
+#endif
 				case 'c': // character
 				default:
 					if(!pad) while((width - 1) > 0) write(padchar);
@@ -804,8 +2113,9 @@ inline size_t myLCD::_printf(const char *data, va_list args){
  */
 inline size_t myLCD::printw(uint8_t width, const char* text, boolean padleft =
 		false, const char symbol = ' ') {
-	size_t n;
-	uint8_t clean = width - strlen_P(text);
+	size_t n = 0;
+	uint8_t l = strlen_P(text);
+	uint8_t clean = width > l ? width - l : 0;
 	if (padleft) n += print(text);
 	while (clean > 0) {
 		n += write(symbol);
@@ -832,6 +2142,7 @@ inline uint8_t myLCD::len(long value) {
 	return len;
 }
 
+#ifndef MYLCD_NOFLOAT
 /**
  * Calculate double digit length (for printing)
  *
@@ -847,6 +2158,7 @@ inline uint8_t myLCD::len(double value, byte digits) {
 	}
 	return l;
 }
+#endif
 
 /**
  * Print integer with predetermined width. Missing (padding) characters will be printed with symbol param.
@@ -859,9 +2171,9 @@ inline uint8_t myLCD::len(double value, byte digits) {
  */
 inline size_t myLCD::printw(uint8_t width, int value, boolean padleft = false,
 		const char symbol = ' ') {
-	size_t n;
+	size_t n = 0;
 	uint8_t l = len(value);
-	uint8_t clean = width - l;
+	uint8_t clean = width > l ? width - l : 0;
 	if (padleft) n += print(value);
 	while (clean > 0) {
 		n += write(symbol);
@@ -871,6 +2183,7 @@ inline size_t myLCD::printw(uint8_t width, int value, boolean padleft = false,
 	return n;
 }
 
+#ifndef MYLCD_NOFLOAT
 /**
  * Print double with predetermined width. Missing (padding) characters will be printed with symbol param.
  *
@@ -883,9 +2196,9 @@ inline size_t myLCD::printw(uint8_t width, int value, boolean padleft = false,
  */
 inline size_t myLCD::printw(uint8_t width, double value, uint8_t digits,
 		boolean padleft = false, const char symbol = ' ') {
-	size_t n;
+	size_t n = 0;
 	uint8_t l = len(value, digits);
-	uint8_t clean = width - l;
+	uint8_t clean = width > l ? width - l : 0;
 	if (padleft) n += print(value, digits);
 	while (clean > 0) {
 		n += write(symbol);
@@ -894,6 +2207,110 @@ inline size_t myLCD::printw(uint8_t width, double value, uint8_t digits,
 	if (!padleft) n += print(value, digits);
 	return n;
 }
+#endif
+
+/**
+ * Calculate fixed-point number length (for printing)
+ *
+ * @param value scaled value
+ * @param scale digits after decimal point
+ * @return length of number
+ */
+inline uint8_t myLCD::_len(long value, uint8_t scale) {
+	uint8_t l = len(value);
+	if (value < 0) --l; // sign is counted separately
+	if (l <= scale) l = scale + 1; // leading zero
+	if (scale > 0) ++l; // decimal point
+	if (value < 0) ++l;
+	return l;
+}
+
+/**
+ * Print fixed-point number using integer arithmetic only
+ *
+ * @param value scaled value
+ * @param scale digits after decimal point
+ * @return length of printed text
+ */
+inline size_t myLCD::_print(long value, uint8_t scale) {
+	size_t n = 0;
+	unsigned long v = value;
+	if (value < 0) {
+		n += write('-');
+		v = -value;
+	}
+	unsigned long div = 1;
+	for (uint8_t i = 0; i < scale; ++i) {
+		div *= 10;
+	}
+	n += print(v / div);
+	if (scale > 0) {
+		n += write('.');
+		v %= div;
+		while (div > 1) { // digits with leading zeros
+			div /= 10;
+			n += write('0' + v / div);
+			v %= div;
+		}
+	}
+	return n;
+}
+
+/**
+ * Print fixed-point number with predetermined width. Missing (padding)
+ * characters will be printed with symbol param.
+ *
+ * @param width of the print
+ * @param value scaled value
+ * @param scale digits after decimal point
+ * @param padleft if true, then left align
+ * @param symbol padding symbol
+ * @return length of printed text
+ */
+inline size_t myLCD::_printw(uint8_t width, long value, uint8_t scale, boolean padleft, const char symbol) {
+	size_t n = 0;
+	uint8_t l = _len(value, scale);
+	if (!padleft && symbol == '0' && value < 0) { // sign goes before zeros
+		n += write('-');
+		value = -value;
+		--l;
+		if (width > 0) --width;
+	}
+	if (padleft) n += _print(value, scale);
+	while (width > l) {
+		n += write(symbol);
+		--width;
+	}
+	if (!padleft) n += _print(value, scale);
+	return n;
+}
+
+/**
+ * Print fixed-point number
+ * @code lcd.print(decimal<1>(215)); // prints 21.5 @endcode
+ *
+ * @param value
+ * @return length of printed text
+ */
+template <uint8_t S>
+inline size_t myLCD::print(decimal <S> value) {
+	return _print(value.value, S);
+}
+
+/**
+ * Print fixed-point number with predetermined width. Missing (padding)
+ * characters will be printed with symbol param.
+ *
+ * @param width of the print
+ * @param value to be printed
+ * @param padleft if true, then left align
+ * @param symbol padding symbol
+ * @return length of printed text
+ */
+template <uint8_t S>
+inline size_t myLCD::printw(uint8_t width, decimal <S> value, boolean padleft, const char symbol) {
+	return _printw(width, value.value, S, padleft, symbol);
+}
 
 
 inline void myLCD::_clean(byte width, byte len, uint8_t value) {
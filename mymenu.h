@@ -0,0 +1,306 @@
+/**
+ * @file mymenu.h
+ *
+ * @date 19.10.2026
+ * @see myLCD
+ */
+
+#ifndef MYMENU_H_
+#define MYMENU_H_
+#include "mylcd.h"
+
+/*************************************//**
+ * Menu engine.
+ * The whole menu tree (labels, links, value bindings and limits) lives in
+ * PROGMEM, only the navigation state is kept in RAM (6 bytes + lcd
+ * reference + table pointer), regardless of the size of the menu.
+ *
+ * Every item links to its parent, first child and siblings by index, so
+ * every keypress is O(1). Moving the selection redraws only the marker
+ * cells, editing a value redraws only the value field.
+ *
+ * @example menu
+ * @code{.cpp}
+ *
+ * 	#include "mymenu.h"
+ * 	myLCD lcd(7,8,6,5,4,3);
+ *
+ * 	int temp = 20;
+ * 	int hyst = 2;
+ *
+ * 	static const prog_char SETUP[] PROGMEM = "Setup";
+ * 	static const prog_char TEMP[] PROGMEM = "Temp";
+ * 	static const prog_char HYST[] PROGMEM = "Hyst";
+ * 	static const prog_char RESET[] PROGMEM = "Reset";
+ *
+ * 	static const myMenuItem MENU[] PROGMEM = {
+ * 		MENU_ITEM (SETUP, MENU_NONE, 1,         MENU_NONE, 3),          // 0
+ * 		MENU_VALUE(TEMP,  0,                    MENU_NONE, 2, &temp, 5, 35, 1), // 1
+ * 		MENU_VALUE(HYST,  0,                    1, MENU_NONE, &hyst, 0, 9, 1),  // 2
+ * 		MENU_ITEM (RESET, MENU_NONE, MENU_NONE, 0,         MENU_NONE),  // 3
+ * 	};
+ *
+ * 	myMenu menu(lcd, MENU, 2, 16);
+ *
+ * 	void setup(){
+ * 		lcd.begin(16, 2);
+ * 		menu.begin();
+ * 	}
+ *
+ * 	void loop(){
+ * 		// call menu.up(), menu.down(), menu.back() on keypress
+ * 		if (enterPressed() && menu.enter() == 3) reset();
+ * 	}
+ * @endcode
+ *
+ ***************************************/
+
+#define MENU_NONE 0xFF //!< no link
+#ifndef MENU_MARKER
+#define MENU_MARKER '>' //!< selection marker
+#endif
+#ifndef MENU_EDITMARKER
+#define MENU_EDITMARKER '*' //!< selection marker while editing a value
+#endif
+#ifndef MENU_VALUEWIDTH
+#define MENU_VALUEWIDTH 5 //!< width of the value field in the right edge of the line
+#endif
+
+/**
+ * Menu item. Tables of items are stored in PROGMEM.
+ */
+struct myMenuItem {
+		const char *label; //!< PROGMEM label
+		uint8_t parent; //!< index of the parent item or MENU_NONE
+		uint8_t child; //!< index of the first child item or MENU_NONE
+		uint8_t prev; //!< index of the previous sibling or MENU_NONE
+		uint8_t next; //!< index of the next sibling or MENU_NONE
+		int *value; //!< bound value or NULL
+		int min; //!< minimum of value
+		int max; //!< maximum of value
+		int step; //!< increment of value
+};
+
+//! Submenu or action item
+#define MENU_ITEM(label, parent, child, prev, next) \
+	{ label, parent, child, prev, next, NULL, 0, 0, 0 }
+//! Item bound to integer value
+#define MENU_VALUE(label, parent, prev, next, value, min, max, step) \
+	{ label, parent, MENU_NONE, prev, next, value, min, max, step }
+
+class myMenu {
+	public:
+		/**
+		 * Constructor
+		 * @param lcd Display
+		 * @param items PROGMEM item table, item 0 is the first top level item
+		 * @param rows Number of lines used by menu
+		 * @param cols Number of columns used by menu
+		 */
+		myMenu(myLCD &lcd, const myMenuItem *items, byte rows, byte cols)
+				: _lcd(lcd), _items(items), _rows(rows), _cols(cols), _sel(0), _top(0), _row(0), _edit(false) {
+		}
+		;
+		void begin();
+		void draw();
+		void up();
+		void down();
+		uint8_t enter();
+		void back();
+
+		/**
+		 * @return index of the selected item
+		 */
+		uint8_t selected() const {
+			return _sel;
+		}
+		/**
+		 * @return true if the selected value is being edited
+		 */
+		boolean editing() const {
+			return _edit;
+		}
+
+	private:
+		int *_value(uint8_t item) const;
+		void _line(byte row, uint8_t item);
+		void _marker();
+		void _number(byte row, uint8_t item);
+		void _change(int8_t dir);
+
+		myLCD &_lcd;
+		const myMenuItem *_items;
+		uint8_t _rows;
+		uint8_t _cols;
+		uint8_t _sel; //!< selected item
+		uint8_t _top; //!< item on the first line
+		uint8_t _row; //!< line of the selected item
+		boolean _edit;
+};
+
+inline int *myMenu::_value(uint8_t item) const {
+	return (int*) pgm_read_word(&_items[item].value);
+}
+
+/**
+ * Shows the first top level item
+ */
+inline void myMenu::begin() {
+	_sel = _top = _row = 0;
+	_edit = false;
+	draw();
+}
+
+/**
+ * Redraws all menu lines
+ */
+inline void myMenu::draw() {
+	uint8_t item = _top;
+	for (byte row = 0; row < _rows; ++row) {
+		_line(row, item);
+		if (item != MENU_NONE) item = pgm_read_byte(&_items[item].next);
+	}
+}
+
+/**
+ * Draws single line: marker, label and value. Unused cells are cleared.
+ * @param row Line
+ * @param item Item index or MENU_NONE for empty line
+ */
+inline void myMenu::_line(byte row, uint8_t item) {
+	_lcd.setCursor(0, row);
+	_lcd.write(item == _sel ? (_edit ? MENU_EDITMARKER : MENU_MARKER) : ' ');
+
+	byte width = _cols - 1;
+	if (item != MENU_NONE) {
+		if (_value(item) != NULL) width -= MENU_VALUEWIDTH;
+		const char *label = (const char*) pgm_read_word(&_items[item].label);
+		char c;
+		while (width > 0 && (c = pgm_read_byte(label++)) != 0) {
+			_lcd.write(c);
+			--width;
+		}
+	}
+	while (width > 0) {
+		_lcd.write(' ');
+		--width;
+	}
+	if (item != MENU_NONE && _value(item) != NULL) _lcd.printw(MENU_VALUEWIDTH, *_value(item));
+}
+
+/**
+ * Redraws the selection marker
+ */
+inline void myMenu::_marker() {
+	_lcd.setCursor(0, _row);
+	_lcd.write(_edit ? MENU_EDITMARKER : MENU_MARKER);
+}
+
+/**
+ * Redraws the value field only
+ */
+inline void myMenu::_number(byte row, uint8_t item) {
+	_lcd.setCursor(_cols - MENU_VALUEWIDTH, row);
+	_lcd.printw(MENU_VALUEWIDTH, *_value(item));
+}
+
+/**
+ * Steps the edited value within its limits
+ * @param dir 1 or -1
+ */
+inline void myMenu::_change(int8_t dir) {
+	int *value = _value(_sel);
+	int step = pgm_read_word(&_items[_sel].step);
+	int lo = pgm_read_word(&_items[_sel].min);
+	int hi = pgm_read_word(&_items[_sel].max);
+	int v = *value;
+
+	if (dir > 0) v = (v > hi - step) ? hi : v + step;
+	else v = (v < lo + step) ? lo : v - step;
+	if (v == *value) return;
+	*value = v;
+	_number(_row, _sel);
+}
+
+/**
+ * Selects previous item or increases edited value
+ */
+inline void myMenu::up() {
+	if (_edit) {
+		_change(1);
+		return;
+	}
+	uint8_t prev = pgm_read_byte(&_items[_sel].prev);
+	if (prev == MENU_NONE) return;
+	if (_row > 0) {
+		_lcd.setCursor(0, _row);
+		_lcd.write(' ');
+		--_row;
+		_sel = prev;
+		_marker();
+	} else { // scroll
+		_sel = _top = prev;
+		draw();
+	}
+}
+
+/**
+ * Selects next item or decreases edited value
+ */
+inline void myMenu::down() {
+	if (_edit) {
+		_change(-1);
+		return;
+	}
+	uint8_t next = pgm_read_byte(&_items[_sel].next);
+	if (next == MENU_NONE) return;
+	if (_row < _rows - 1) {
+		_lcd.setCursor(0, _row);
+		_lcd.write(' ');
+		++_row;
+		_sel = next;
+		_marker();
+	} else { // scroll
+		_sel = next;
+		_top = pgm_read_byte(&_items[_top].next);
+		draw();
+	}
+}
+
+/**
+ * Opens submenu, starts or ends editing of the value
+ * @return index of the selected action item, otherwise MENU_NONE
+ */
+inline uint8_t myMenu::enter() {
+	uint8_t child = pgm_read_byte(&_items[_sel].child);
+	if (child != MENU_NONE) {
+		_sel = _top = child;
+		_row = 0;
+		_edit = false;
+		draw();
+	} else if (_value(_sel) != NULL) {
+		_edit = !_edit;
+		_marker();
+	} else {
+		return _sel;
+	}
+	return MENU_NONE;
+}
+
+/**
+ * Ends editing or returns to parent menu
+ */
+inline void myMenu::back() {
+	if (_edit) {
+		_edit = false;
+		_marker();
+		return;
+	}
+	uint8_t parent = pgm_read_byte(&_items[_sel].parent);
+	if (parent == MENU_NONE) return;
+	_sel = _top = parent;
+	_row = 0;
+	draw();
+}
+
+#endif /* MYMENU_H_ */
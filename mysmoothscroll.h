@@ -0,0 +1,200 @@
+/**
+ * @file mysmoothscroll.h
+ *
+ * @date 19.10.2026
+ * @see myLCD::scroll
+ */
+
+#ifndef MYSMOOTHSCROLL_H_
+#define MYSMOOTHSCROLL_H_
+#include "mylcd.h"
+#include "myfont.h"
+
+/*************************************//**
+ * Smooth (pixel by pixel) scrolling of PROGMEM text.
+ * The region of up to 8 cells shows custom characters 0..cells-1 (or
+ * starting from given slot). Text is rendered from PROGMEM font into the
+ * CGRAM slots, every step shifts the text by one pixel column and uploads
+ * only the bitmap rows that changed. Nothing is kept in RAM, the previous
+ * frame is recomputed from the font.
+ *
+ * Every step returns the number of bytes sent to display. With standard
+ * LiquidCrystal library in 4-bit mode every byte is sent as two nibbles,
+ * each followed by 100 us delay, so one byte takes about 250 microseconds.
+ * Time step() with micros() on the target to choose the step rate that fits
+ * into loop time.
+ *
+ * Scrolling is driven either by update() from loop() or by the display's
+ * timer list (myLCD::service(), myLCD::nextDeadline()).
+ *
+ * @example smoothscroll
+ * @code{.cpp}
+ *
+ * 	#include "mysmoothscroll.h"
+ * 	myLCD lcd(7,8,6,5,4,3);
+ * 	mySmoothScroll ticker(lcd);
+ *
+ * 	static const prog_char NEWS[] PROGMEM = "Boiler temperature too high";
+ *
+ * 	void setup(){
+ * 		lcd.begin(16, 2);
+ * 		ticker.begin(4, 1, NEWS, 8, 40); // 8 cells from (4,1), step every 40 ms
+ * 	}
+ *
+ * 	void loop(){
+ * 		ticker.update();
+ * 	}
+ * @endcode
+ *
+ ***************************************/
+
+#define SMOOTH_GAP 1 //!< blank pixel columns between characters
+
+class mySmoothScroll: public myTimer {
+	public:
+		/**
+		 * Constructor
+		 * @param lcd Display
+		 */
+		mySmoothScroll(myLCD &lcd)
+				: _lcd(lcd), _text(NULL), _len(0), _pos(0), _cells(0), _slot(0), _interval(0), _sent(0) {
+		}
+		;
+		~mySmoothScroll() {
+			_lcd.cancel(*this);
+		}
+		size_t begin(byte col, byte row, const PROGMEM char *text, uint8_t cells, uint16_t interval, uint8_t slot = 0);
+		void stop();
+		size_t update();
+		size_t step();
+		void fire(unsigned long now);
+
+	private:
+		byte _column(int16_t x) const;
+		size_t _upload(boolean all);
+
+		myLCD &_lcd;
+		const char *_text;
+		uint16_t _len; //!< text width in pixel columns
+		int16_t _pos; //!< pixel column on the left edge of the region
+		uint8_t _cells;
+		uint8_t _slot;
+		uint16_t _interval;
+		unsigned long _due;
+		size_t _sent; //!< bytes sent by the last timed step
+};
+
+/**
+ * Starts scrolling. The region is filled with custom characters and
+ * the whole bitmap is uploaded once.
+ *
+ * @param col Cursor Position
+ * @param row Cursor Line
+ * @param text PROGMEM text
+ * @param cells Region width 1-8
+ * @param interval Milliseconds per pixel step
+ * @param slot First CGRAM slot used
+ * @return number of bytes sent to display
+ */
+inline size_t mySmoothScroll::begin(byte col, byte row, const char *text, uint8_t cells, uint16_t interval,
+		uint8_t slot) {
+	_cells = min(cells, (uint8_t) (8 - (slot & 0x7)));
+	_slot = slot & 0x7;
+	_text = text;
+	_len = strlen_P(text) * (FONT_WIDTH + SMOOTH_GAP);
+	_pos = -(_cells * FONT_WIDTH); // enter from the right
+	_interval = interval ? interval : 1; // 0 would fire on every service() call
+	_due = millis() + _interval;
+	_lcd.schedule(*this, _due);
+
+	_lcd.setCursor(col, row);
+	for (uint8_t i = 0; i < _cells; ++i) {
+		_lcd.write(_slot + i);
+	}
+	return _cells + 1 + _upload(true);
+}
+
+/**
+ * Stops scrolling. Region keeps its current content.
+ */
+inline void mySmoothScroll::stop() {
+	_text = NULL;
+	_lcd.cancel(*this);
+}
+
+/**
+ * Steps if the time has come. Call it from loop().
+ * @return number of bytes sent to display
+ */
+inline size_t mySmoothScroll::update() {
+	if (_text == NULL) return 0;
+	unsigned long now = millis();
+	if ((long) (now - _due) < 0) return 0;
+	fire(now);
+	return _sent;
+}
+
+/**
+ * Steps and schedules the next step. Called by myLCD::service().
+ */
+inline void mySmoothScroll::fire(unsigned long now) {
+	if (_text == NULL) return;
+	_due += _interval;
+	if ((long) (now - _due) >= 0) _due = now + _interval; // we are late, do not catch up
+	_lcd.schedule(*this, _due);
+	_sent = step();
+}
+
+/**
+ * Shifts text by one pixel column
+ * @return number of bytes sent to display
+ */
+inline size_t mySmoothScroll::step() {
+	if (_text == NULL) return 0;
+	if (++_pos >= (int16_t) _len) {
+		_pos = -(_cells * FONT_WIDTH);
+		return _upload(true);
+	}
+	return _upload(false);
+}
+
+/**
+ * Pixel column of the text
+ * @param x Column, 0 is the left edge of the first character
+ * @return column bits, bit 0 is the top row
+ */
+inline byte mySmoothScroll::_column(int16_t x) const {
+	if (x < 0 || x >= (int16_t) _len) return 0;
+	uint8_t c = x % (FONT_WIDTH + SMOOTH_GAP);
+	if (c >= FONT_WIDTH) return 0;
+	return fontColumn(pgm_read_byte(_text + x / (FONT_WIDTH + SMOOTH_GAP)), c);
+}
+
+/**
+ * Uploads bitmap rows that differ from the previous position
+ * @param all Upload all rows (previous position is unknown)
+ * @return number of bytes sent to display
+ */
+inline size_t mySmoothScroll::_upload(boolean all) {
+	size_t n = 0;
+	for (uint8_t i = 0; i < _cells; ++i) {
+		// columns [0..4] are the previous position, [1..5] are the current one
+		byte cols[FONT_WIDTH + 1];
+		int16_t x = _pos + i * FONT_WIDTH - 1;
+		for (uint8_t c = 0; c <= FONT_WIDTH; ++c) {
+			cols[c] = _column(x + c);
+		}
+
+		for (uint8_t row = 0; row < 8; ++row) {
+			byte prev = 0, bits = 0;
+			for (uint8_t c = 0; c < FONT_WIDTH; ++c) {
+				prev = (prev << 1) | ((cols[c] >> row) & 1);
+				bits = (bits << 1) | ((cols[c + 1] >> row) & 1);
+			}
+			n += _lcd.updateChar(_slot + i, row, bits, all ? ~bits : prev);
+		}
+	}
+	return _lcd.updateDone(n);
+}
+
+#endif /* MYSMOOTHSCROLL_H_ */
@@ -0,0 +1,244 @@
+/**
+ * @file mytextflow.h
+ *
+ * @date 19.10.2026
+ * @see myLCD
+ */
+
+#ifndef MYTEXTFLOW_H_
+#define MYTEXTFLOW_H_
+#include "mylcd.h"
+
+/*************************************//**
+ * Word wrap and paging of long texts.
+ * Text (PROGMEM or RAM) is wrapped into the region by words; words longer
+ * than the line are hyphenated (or hard broken). The start of every page
+ * is indexed once in begin(), so showing page N reads only the characters
+ * of that page and costs one setCursor per line. Lines are padded with
+ * spaces, so nothing is left from the previous page.
+ *
+ * RAM usage is 2 bytes per page (TEXT_PAGES) plus 11 bytes.
+ *
+ * @example textflow
+ * @code{.cpp}
+ *
+ * 	#include "mytextflow.h"
+ * 	myLCD lcd(7,8,6,5,4,3);
+ * 	myTextFlow help(lcd, 0, 0, 16, 2); // whole 16x2 screen
+ *
+ * 	static const prog_char HELP[] PROGMEM = "Hysteresis is the difference between "
+ * 		"switch on and switch off temperatures.\nPress OK to save.";
+ *
+ * 	void setup(){
+ * 		lcd.begin(16, 2);
+ * 		help.begin(HELP);
+ * 		help.show(0);
+ * 	}
+ *
+ * 	void loop(){
+ * 		// call help.next(), help.prev() on keypress
+ * 	}
+ * @endcode
+ *
+ ***************************************/
+
+#ifndef TEXT_PAGES
+#define TEXT_PAGES 16 //!< maximum number of pages, the rest of the text is not shown
+#endif
+#ifndef TEXT_HYPHEN
+#define TEXT_HYPHEN '-' //!< hyphen for words longer than line, 0 for hard break
+#endif
+
+class myTextFlow {
+	public:
+		/**
+		 * Constructor
+		 * @param lcd Display
+		 * @param col Left edge of the region
+		 * @param row Top edge of the region
+		 * @param cols Region width
+		 * @param rows Region height
+		 */
+		myTextFlow(myLCD &lcd, byte col, byte row, byte cols, byte rows)
+				: _lcd(lcd), _text(NULL), _progmem(true), _col(col), _row(row), _cols(cols), _rows(rows), _pages(0), _page(0) {
+		}
+		;
+		uint8_t begin(const PROGMEM char *text);
+		uint8_t begin(const __FlashStringHelper *text);
+		uint8_t begin(const String &text);
+		void show(uint8_t page);
+		boolean next();
+		boolean prev();
+
+		/**
+		 * @return number of pages
+		 */
+		uint8_t pages() const {
+			return _pages;
+		}
+		/**
+		 * @return current page
+		 */
+		uint8_t page() const {
+			return _page;
+		}
+
+	private:
+		char _char(uint16_t i) const;
+		uint16_t _line(uint16_t p, uint16_t &start, uint8_t &len, boolean &hyphen) const;
+		uint8_t _paginate();
+
+		myLCD &_lcd;
+		const char *_text;
+		boolean _progmem;
+		uint8_t _col;
+		uint8_t _row;
+		uint8_t _cols;
+		uint8_t _rows;
+		uint8_t _pages;
+		uint8_t _page;
+		uint16_t _index[TEXT_PAGES]; //!< text position of the first character of every page
+};
+
+/**
+ * Sets PROGMEM text and builds the page index
+ * @param text PROGMEM text
+ * @return number of pages
+ */
+inline uint8_t myTextFlow::begin(const char *text) {
+	_text = text;
+	_progmem = true;
+	return _paginate();
+}
+
+inline uint8_t myTextFlow::begin(const __FlashStringHelper *text) {
+	return begin((const char*) text);
+}
+
+/**
+ * Sets RAM text and builds the page index. The String must not be
+ * changed while it is shown.
+ * @param text
+ * @return number of pages
+ */
+inline uint8_t myTextFlow::begin(const String &text) {
+	_text = text.c_str();
+	_progmem = false;
+	return _paginate();
+}
+
+inline char myTextFlow::_char(uint16_t i) const {
+	return _progmem ? pgm_read_byte(_text + i) : _text[i];
+}
+
+/**
+ * Wraps one line
+ * @param p Text position
+ * @param start First character of the line (leading spaces are skipped)
+ * @param len Number of characters on the line
+ * @param hyphen Line ends with hyphen
+ * @return text position of the next line
+ */
+inline uint16_t myTextFlow::_line(uint16_t p, uint16_t &start, uint8_t &len, boolean &hyphen) const {
+	while (_char(p) == ' ')
+		++p;
+	start = p;
+	hyphen = false;
+
+	uint8_t space = 0; // length of the line up to the last space
+	for (len = 0; len < _cols; ++len) {
+		char c = _char(p + len);
+		if (c == 0) return p + len;
+		if (c == '\n') return p + len + 1;
+		if (c == ' ') space = len;
+	}
+	char c = _char(p + len);
+	if (c == '\n') return p + len + 1; // word ends with the line
+	if (c == 0 || c == ' ') return p + len;
+	if (space > 0) { // break in the last space
+		len = space;
+		return p + space + 1;
+	}
+#if TEXT_HYPHEN
+	if (_cols > 1) {
+		--len;
+		hyphen = true;
+	}
+#endif
+	return p + len;
+}
+
+/**
+ * Finds the first character of every page
+ * @return number of pages
+ */
+inline uint8_t myTextFlow::_paginate() {
+	uint16_t p = 0, start;
+	uint8_t len;
+	boolean hyphen;
+
+	_pages = 0;
+	_page = 0;
+	while (_pages < TEXT_PAGES) {
+		while (_char(p) == ' ' || _char(p) == '\n')
+			++p;
+		if (_char(p) == 0) break;
+		_index[_pages++] = p;
+		for (uint8_t r = 0; r < _rows; ++r) {
+			p = _line(p, start, len, hyphen);
+		}
+	}
+	return _pages;
+}
+
+/**
+ * Shows page
+ * @param page 0 is the first page
+ */
+inline void myTextFlow::show(uint8_t page) {
+	uint16_t p = 0, start;
+	uint8_t len;
+	boolean hyphen;
+
+	if (page < _pages) p = _index[page];
+	else if (_pages > 0) return;
+	_page = page;
+
+	for (uint8_t r = 0; r < _rows; ++r) {
+		_lcd.setCursor(_col, _row + r);
+		p = _line(p, start, len, hyphen);
+		uint8_t width = _cols - len;
+		while (len--) {
+			_lcd.write(_char(start++));
+		}
+		if (hyphen) {
+			_lcd.write(TEXT_HYPHEN);
+			--width;
+		}
+		while (width--) {
+			_lcd.write(' ');
+		}
+	}
+}
+
+/**
+ * Shows next page
+ * @return false on the last page
+ */
+inline boolean myTextFlow::next() {
+	if (_page + 1 >= _pages) return false;
+	show(_page + 1);
+	return true;
+}
+
+/**
+ * Shows previous page
+ * @return false on the first page
+ */
+inline boolean myTextFlow::prev() {
+	if (_page == 0) return false;
+	show(_page - 1);
+	return true;
+}
+
+#endif /* MYTEXTFLOW_H_ */
@@ -0,0 +1,158 @@
+#!/usr/bin/env python3
+"""Glyph atlas compiler for myLCD::createChar(location, const myGlyph *).
+
+Reads glyph definitions and writes a header with PROGMEM atlas:
+identical glyphs are stored once, glyphs that differ from an earlier
+base glyph in a few rows are stored as row deltas (equal delta rows are
+shared between glyphs). Prints report of the
+flash usage compared with raw 8-byte bitmaps.
+
+Usage:
+    atlas.py glyphs.txt NAME > glyphs.h
+
+Input, one glyph per block; rows as pixels (# or 1 is on) or one line of
+8 numbers:
+
+    # battery, 5 frames
+    glyph BATTERY0
+    .###.
+    #...#
+    #...#
+    #...#
+    #...#
+    #...#
+    #####
+    .....
+    glyph BELL 0x04 0x0E 0x0E 0x0E 0x1F 0x00 0x04 0x00
+"""
+
+import sys
+
+ENTRY = 5  # sizeof(myGlyph) on AVR: two pointers and a mask
+MAX_DELTA = 4  # rows; glyphs differing in more rows become new bases
+UPLOAD = 1 + 8 + 1  # bus bytes of myLCD::createChar(): selectChar(), 8 rows, restoreCursor()
+
+
+def parse(lines):
+    glyphs = []
+    rows = None
+    for number, line in enumerate(lines, 1):
+        line = line.split('//')[0].strip()
+        if not line or line.startswith('#') and set(line) - set('#.01'):  # comment
+            continue
+        words = line.split()
+        if words[0] == 'glyph':
+            if len(words) == 10:
+                glyphs.append((words[1], [int(w, 0) & 0x1F for w in words[2:]]))
+                rows = None
+            elif len(words) == 2:
+                rows = []
+                glyphs.append((words[1], rows))
+            else:
+                raise SystemExit('line %d: glyph NAME [8 rows]' % number)
+        elif rows is not None and len(rows) < 8:
+            bits = 0
+            for c in line[:5].ljust(5, '.'):
+                bits = (bits << 1) | (c in '#1')
+            rows.append(bits)
+        else:
+            raise SystemExit('line %d: unexpected %r' % (number, line))
+    for name, rows in glyphs:
+        if len(rows) != 8:
+            raise SystemExit('glyph %s: %d rows, 8 expected' % (name, len(rows)))
+    return glyphs
+
+
+def share(deltas, run):
+    """Appends delta rows, reusing an equal run or the tail already in deltas. Returns offset."""
+    for offset in range(len(deltas) + 1):
+        tail = deltas[offset:offset + len(run)]
+        if run[:len(tail)] == tail:
+            deltas.extend(run[len(tail):])
+            return offset
+    return len(deltas)
+
+
+def compile_atlas(glyphs):
+    """Returns bases, deltas, entries (base, delta offset, mask) and handle of every glyph."""
+    bases, deltas, entries = [], [], []
+    unique = {}
+    handles = []
+    for name, rows in glyphs:
+        key = tuple(rows)
+        if key not in unique:
+            best, diff = None, 9
+            for i, base in enumerate(bases):
+                d = sum(1 for a, b in zip(base, rows) if a != b)
+                if d < diff:
+                    best, diff = i, d
+            if best is None or diff > MAX_DELTA:
+                bases.append(rows)
+                entries.append((len(bases) - 1, 0, 0))
+            else:
+                mask = 0
+                run = []
+                for r in range(8):
+                    if rows[r] != bases[best][r]:
+                        mask |= 1 << r
+                        run.append(rows[r])
+                entries.append((best, share(deltas, run), mask))
+            unique[key] = len(entries) - 1
+        handles.append((name, unique[key]))
+    return bases, deltas, entries, handles
+
+
+def report(glyphs, bases, deltas, entries):
+    raw = len(glyphs) * 8
+    atlas = len(bases) * 8 + len(deltas) + len(entries) * ENTRY
+    return [
+        'glyphs: %d, unique: %d, bases: %d, delta rows: %d' % (len(glyphs), len(entries), len(bases), len(deltas)),
+        'flash: raw %d bytes, atlas %d bytes, saved %d bytes (%d%%)' % (
+            raw, atlas, raw - atlas, (raw - atlas) * 100 // raw if raw else 0),
+        'upload per glyph: %d bus bytes raw and atlas; flash reads raw 8, atlas 8 + %d (entry)' % (UPLOAD, ENTRY),
+    ]
+
+
+def header(name, source, glyphs, bases, deltas, entries, handles):
+    out = ['/**', ' * @file %s.h' % name.lower(), ' *',
+           ' * Generated by tools/atlas.py from %s, do not edit.' % source, ' *']
+    out += [' * ' + line for line in report(glyphs, bases, deltas, entries)]
+    out += [' */', '', '#ifndef %s_H_' % name, '#define %s_H_' % name, '#include "mylcd.h"', '']
+
+    def table(label, values):
+        out.append('static const byte %s[] PROGMEM = {' % label)
+        values = values or [0]  # empty arrays are not allowed
+        for i in range(0, len(values), 8):
+            out.append('\t' + ', '.join('0x%02X' % v for v in values[i:i + 8]) + ',')
+        out.append('};')
+        out.append('')
+
+    table('%s_BASES' % name, [v for base in bases for v in base])
+    table('%s_DELTAS' % name, deltas)
+    out.append('static const myGlyph %s[] PROGMEM = {' % name)
+    for i, (base, offset, mask) in enumerate(entries):
+        names = ', '.join(n for n, e in handles if e == i)
+        out.append('\t{ %s_BASES + %d, %s_DELTAS + %d, 0x%02X }, // %s' % (name, base * 8, name, offset, mask, names))
+    out.append('};')
+    out.append('')
+    for n, e in handles:
+        out.append('static const myGlyph *const %s = %s + %d;' % (n, name, e))
+    out += ['', '#endif /* %s_H_ */' % name, '']
+    return '\n'.join(out)
+
+
+def main(argv):
+    if len(argv) != 3:
+        print(__doc__)
+        return 1
+    with open(argv[1]) as f:
+        glyphs = parse(f)
+    bases, deltas, entries, handles = compile_atlas(glyphs)
+    sys.stdout.write(header(argv[2].upper(), argv[1], glyphs, bases, deltas, entries, handles))
+    for line in report(glyphs, bases, deltas, entries):
+        sys.stderr.write(line + '\n')
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
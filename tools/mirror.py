@@ -0,0 +1,116 @@
+#!/usr/bin/env python3
+"""Decoder for the myLCD mirror stream (see myLCD::mirror in mylcd.h).
+
+Reconstructs the screen from the delta frames and prints it after every
+frame. Custom characters are shown as digits 0-7, their bitmaps are kept
+in Screen.glyphs.
+
+Usage:
+    mirror.py /dev/ttyUSB0 [baud]   read from serial port (needs pyserial)
+    mirror.py capture.bin           read from file
+    mirror.py -                     read from stdin
+"""
+
+import sys
+
+SYNC = 0xFE
+
+
+class Screen:
+    def __init__(self):
+        self.cols = 0
+        self.rows = 0
+        self.cells = []
+        self.glyphs = [[0] * 8 for _ in range(8)]
+        self.flags = 0
+        self.cursor = 0
+        self.seq = None
+        self.synced = False  # False until the first full frame or after lost frame
+        self.frames = 0
+        self.errors = 0
+
+    def apply(self, seq, payload):
+        """Applies frame payload, returns False if frame was rejected."""
+        full = len(payload) > 0 and payload[0] == 0xA0
+        if not full and (not self.synced or seq != (self.seq + 1) & 0xFF):
+            self.synced = False  # lost frame, wait for the next resync
+            self.seq = seq
+            return False
+        self.seq = seq
+        i = 0
+        while i < len(payload):
+            tag = payload[i]
+            if tag == 0xA0:
+                self.cols, self.rows = payload[i + 1], payload[i + 2]
+                self.cells = [ord(' ')] * (self.cols * self.rows)
+                self.synced = True
+                i += 3
+            elif tag < 0x80:
+                n = payload[i + 1]
+                self.cells[tag:tag + n] = payload[i + 2:i + 2 + n]
+                i += 2 + n
+            elif tag & 0xF8 == 0x80:
+                self.glyphs[tag & 0x07] = list(payload[i + 1:i + 9])
+                i += 9
+            elif tag == 0x90:
+                self.flags, self.cursor = payload[i + 1], payload[i + 2]
+                i += 3
+            else:
+                raise ValueError('unknown record 0x%02X' % tag)
+        self.frames += 1
+        return True
+
+    def lines(self):
+        out = []
+        for r in range(self.rows):
+            row = self.cells[r * self.cols:(r + 1) * self.cols]
+            out.append(''.join(chr(ord('0') + c) if c < 8 else chr(c) for c in row))
+        return out
+
+
+def frames(read):
+    """Yields (seq, payload) of frames with valid checksum."""
+    while True:
+        b = read(1)
+        if not b:
+            return
+        if b[0] != SYNC:
+            continue
+        head = read(2)
+        if len(head) < 2:
+            return
+        seq, length = head
+        payload = read(length)
+        check = read(1)
+        if len(payload) < length or not check:
+            return
+        if sum(payload) & 0xFF == check[0]:
+            yield seq, payload
+
+
+def main(argv):
+    if len(argv) < 2:
+        print(__doc__)
+        return 1
+    if argv[1] == '-':
+        stream = sys.stdin.buffer
+    elif argv[1].startswith('/dev/') or argv[1].upper().startswith('COM'):
+        import serial
+        stream = serial.Serial(argv[1], int(argv[2]) if len(argv) > 2 else 9600)
+    else:
+        stream = open(argv[1], 'rb')
+
+    screen = Screen()
+    for seq, payload in frames(stream.read):
+        if not screen.apply(seq, payload):
+            print('-- frame %d lost, waiting for resync' % seq)
+            continue
+        state = 'on' if screen.flags & 0x01 else 'off'
+        print('-- frame %d, %d bytes, display %s, cursor %d' % (seq, len(payload) + 4, state, screen.cursor))
+        for line in screen.lines():
+            print('|' + line + '|')
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))